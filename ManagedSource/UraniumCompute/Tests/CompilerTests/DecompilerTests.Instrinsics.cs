@@ -77,4 +77,24 @@ public partial class DecompilerTests
             }
             """);
     }
+
+    [Test]
+    public void CompilesWaveIntrinsics()
+    {
+        AssertFunc((Span<uint> values) =>
+        {
+            var index = (int)GpuIntrinsic.GetGlobalInvocationId().X;
+            values[index] = GpuIntrinsic.WavePrefixSum(values[index]) + GpuIntrinsic.WaveActiveSum(values[index]);
+        }, """
+            RWStructuredBuffer<uint> values : register(u0);
+            [numthreads(1, 1, 1)]
+            void main(uint3 globalInvocationID : SV_DispatchThreadID)
+            {
+                int V_0;
+                V_0 = globalInvocationID.x;
+                values[V_0] = (WavePrefixSum(values[V_0]) + WaveActiveSum(values[V_0]));
+                return ;
+            }
+            """);
+    }
 }
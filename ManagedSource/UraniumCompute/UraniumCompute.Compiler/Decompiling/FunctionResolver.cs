@@ -1,5 +1,6 @@
 ﻿using System.Numerics;
 using Mono.Cecil;
+using UraniumCompute.Compiler.InterimStructs;
 
 namespace UraniumCompute.Compiler.Decompiling;
 
@@ -8,6 +9,11 @@ internal static class FunctionResolver
     public static FunctionSymbol Resolve(MethodReference methodReference, Action<MethodReference> userFunctionCallback,
         Action<TypeReference> userTypeCallback)
     {
+        if (methodReference.DeclaringType.FullName == typeof(GpuIntrinsic).FullName)
+        {
+            return IntrinsicFunctionSymbol.ResolveGpuIntrinsic(methodReference);
+        }
+
         if (methodReference.DeclaringType.Namespace == typeof(MathF).Namespace
             || methodReference.DeclaringType.Namespace == typeof(Matrix4x4).Namespace
             || IsIntrinsicType(methodReference.DeclaringType))
@@ -1,5 +1,6 @@
 ﻿using System.Numerics;
 using System.Reflection;
+using Mono.Cecil;
 using UraniumCompute.Common.Math;
 
 namespace UraniumCompute.Compiler.Decompiling;
@@ -145,4 +146,13 @@ internal sealed class IntrinsicFunctionSymbol : FunctionSymbol
     {
         return functions[(name, argsCount)];
     }
+
+    // Resolve a GpuIntrinsic method that maps to an HLSL intrinsic with the same name,
+    // overloads are resolved by the HLSL compiler, so argument types are taken from the call site.
+    public static IntrinsicFunctionSymbol ResolveGpuIntrinsic(MethodReference methodReference)
+    {
+        var returnType = TypeResolver.CreateType(methodReference.ReturnType, _ => { });
+        var arguments = methodReference.Parameters.Select(x => TypeResolver.CreateType(x.ParameterType, _ => { }));
+        return new IntrinsicFunctionSymbol(methodReference.Name, returnType, arguments);
+    }
 }
@@ -8,4 +8,52 @@ public static class GpuIntrinsic
 {
     [MethodImpl(MethodImplOptions.NoInlining)]
     public static Vector3Uint GetGlobalInvocationId() => default;
+
+    // Subgroup (wave) operations, translated to HLSL intrinsics with the same names.
+    // See AdapterInfo.SubgroupOperations for the operations supported by an adapter.
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static uint WaveGetLaneCount() => default;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static uint WaveGetLaneIndex() => default;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static bool WaveIsFirstLane() => default;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static int WaveActiveSum(int value) => default;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static uint WaveActiveSum(uint value) => default;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static float WaveActiveSum(float value) => default;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static int WavePrefixSum(int value) => default;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static uint WavePrefixSum(uint value) => default;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static float WavePrefixSum(float value) => default;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static int WaveActiveMin(int value) => default;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static uint WaveActiveMin(uint value) => default;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static float WaveActiveMin(float value) => default;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static int WaveActiveMax(int value) => default;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static uint WaveActiveMax(uint value) => default;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static float WaveActiveMax(float value) => default;
 }
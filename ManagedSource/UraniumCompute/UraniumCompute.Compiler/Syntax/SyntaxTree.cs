@@ -623,7 +623,7 @@ internal class SyntaxTree
                 stack.Push(new ArgumentExpressionSyntax("globalInvocationID", TypeResolver.CreateType<Vector3Uint>()));
                 break;
             default:
-                throw new InvalidOperationException($"Unknown instruction: {Current}");
+                return ParseGeneralCallExpression(methodReference);
         }
 
         NextInstruction();
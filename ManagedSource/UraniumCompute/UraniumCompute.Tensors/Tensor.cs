@@ -126,8 +126,7 @@ public sealed class Tensor<T> : IDisposable
             cmd.MemoryBarrier(hostBuffer, AccessFlags.TransferWrite, AccessFlags.HostRead);
         }
 
-        commandList.Submit();
-        await Task.Run(() => commandList.CompletionFence.WaitOnCpu());
+        await commandList.SubmitAsync();
 
         hostStorage = new T[Shape.FlatLength];
 
@@ -176,8 +175,7 @@ public sealed class Tensor<T> : IDisposable
             cmd.MemoryBarrier(deviceStorage, AccessFlags.TransferWrite, AccessFlags.KernelRead);
         }
 
-        commandList.Submit();
-        await Task.Run(() => commandList.CompletionFence.WaitOnCpu());
+        await commandList.SubmitAsync();
     }
 
     public void WriteTo(TextWriter writer)
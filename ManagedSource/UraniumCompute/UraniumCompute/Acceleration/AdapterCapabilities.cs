@@ -0,0 +1,119 @@
+﻿using System.Runtime.InteropServices;
+using UraniumCompute.Backend;
+using UraniumCompute.Common.Math;
+
+namespace UraniumCompute.Acceleration;
+
+/// <summary>
+///     Capabilities and limits of backend's hardware adapter.
+///     Can be used to choose workgroup and tile sizes without creating a compute device.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct AdapterCapabilities
+{
+    /// <summary>
+    ///     Maximum number of memory heaps an adapter can report.
+    /// </summary>
+    public const int MaxMemoryHeaps = 16;
+
+    /// <summary>
+    ///     Maximum number of invocations in a workgroup along each dimension.
+    /// </summary>
+    public readonly Vector3Uint MaxWorkgroupSize;
+
+    /// <summary>
+    ///     Maximum number of workgroups in a single dispatch along each dimension.
+    /// </summary>
+    public readonly Vector3Uint MaxWorkgroupCount;
+
+    /// <summary>
+    ///     Maximum total number of invocations in a workgroup.
+    /// </summary>
+    public readonly uint MaxWorkgroupInvocations;
+
+    /// <summary>
+    ///     Maximum size of groupshared memory per workgroup in bytes.
+    /// </summary>
+    public readonly uint MaxSharedMemorySize;
+
+    /// <summary>
+    ///     Maximum size of a buffer bound to a kernel in bytes.
+    /// </summary>
+    public readonly uint MaxStorageBufferRange;
+
+    /// <summary>
+    ///     Default number of invocations in a subgroup (wave).
+    /// </summary>
+    public readonly uint SubgroupSize;
+
+    /// <summary>
+    ///     Minimum value of <see cref="Kernel.Desc.RequiredSubgroupSize" />, zero if not supported.
+    /// </summary>
+    public readonly uint MinSubgroupSize;
+
+    /// <summary>
+    ///     Maximum value of <see cref="Kernel.Desc.RequiredSubgroupSize" />, zero if not supported.
+    /// </summary>
+    public readonly uint MaxSubgroupSize;
+
+    /// <summary>
+    ///     Subgroup operations supported in compute kernels.
+    /// </summary>
+    public readonly SubgroupOperationFlags SubgroupOperations;
+
+    /// <summary>
+    ///     Nanoseconds per timestamp tick, zero if timestamps are not supported.
+    /// </summary>
+    public readonly float TimestampPeriod;
+
+    /// <summary>
+    ///     Optional device features supported by the adapter.
+    /// </summary>
+    public readonly DeviceFeatureFlags SupportedFeatures;
+
+    /// <summary>
+    ///     Number of memory heaps.
+    /// </summary>
+    /// <seealso cref="GetMemoryHeap" />
+    public readonly int MemoryHeapCount;
+
+    private unsafe fixed byte memoryHeaps[MaxMemoryHeaps * 16];
+
+    /// <summary>
+    ///     Get a device memory heap.
+    /// </summary>
+    /// <param name="index">Index of the heap, must be less than <see cref="MemoryHeapCount" />.</param>
+    /// <returns>The heap description.</returns>
+    public unsafe MemoryHeapInfo GetMemoryHeap(int index)
+    {
+        if ((uint)index >= (uint)MemoryHeapCount)
+        {
+            throw new ArgumentOutOfRangeException(nameof(index));
+        }
+
+        fixed (byte* ptr = memoryHeaps)
+        {
+            return ((MemoryHeapInfo*)ptr)[index];
+        }
+    }
+
+    /// <summary>
+    ///     Get the total size of the heaps of the specified memory kind.
+    /// </summary>
+    /// <param name="kind">Kind of memory.</param>
+    /// <returns>Total size in bytes.</returns>
+    public ulong GetTotalMemorySize(MemoryKindFlags kind)
+    {
+        var result = 0ul;
+        for (var i = 0; i < MemoryHeapCount; ++i)
+        {
+            var heap = GetMemoryHeap(i);
+            if (heap.Kind.HasFlag(kind))
+            {
+                result += heap.Size;
+            }
+        }
+
+        return result;
+    }
+}
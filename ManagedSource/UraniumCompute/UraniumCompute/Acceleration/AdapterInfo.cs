@@ -1,5 +1,8 @@
 ﻿using System.Runtime.InteropServices;
 using System.Text;
+using UraniumCompute.Backend;
+using UraniumCompute.Common.Math;
+using UraniumCompute.Compilation;
 
 namespace UraniumCompute.Acceleration;
 
@@ -14,6 +17,11 @@ public struct AdapterInfo
     /// </summary>
     public const int MaxNameLength = 256;
 
+    /// <summary>
+    ///     Size of <see cref="AdapterInfo.DeviceUuid" /> in bytes.
+    /// </summary>
+    public const int UuidSize = 16;
+
     /// <summary>
     ///     Adapter ID, used to create a compute device on it.
     /// </summary>
@@ -30,6 +38,51 @@ public struct AdapterInfo
     /// <seealso cref="GetNameAsString()" />
     public unsafe fixed byte Name[MaxNameLength];
 
+    /// <summary>
+    ///     Default number of invocations in a subgroup (wave).
+    /// </summary>
+    public readonly uint SubgroupSize;
+
+    /// <summary>
+    ///     Minimum value of <see cref="Backend.Kernel.Desc.RequiredSubgroupSize" />, zero if not supported.
+    /// </summary>
+    public readonly uint MinSubgroupSize;
+
+    /// <summary>
+    ///     Maximum value of <see cref="Backend.Kernel.Desc.RequiredSubgroupSize" />, zero if not supported.
+    /// </summary>
+    public readonly uint MaxSubgroupSize;
+
+    /// <summary>
+    ///     Subgroup operations supported in compute kernels.
+    /// </summary>
+    public readonly SubgroupOperationFlags SubgroupOperations;
+
+    /// <summary>
+    ///     Maximum number of workgroups in a single dispatch along each dimension.
+    /// </summary>
+    public readonly Vector3Uint MaxWorkgroupCount;
+
+    /// <summary>
+    ///     Optional device features supported by the adapter.
+    /// </summary>
+    public readonly DeviceFeatureFlags SupportedFeatures;
+
+    /// <summary>
+    ///     Newest kernel target environment, see <see cref="KernelCompiler.Desc.TargetEnv" />.
+    /// </summary>
+    public readonly KernelTargetEnv TargetEnv;
+
+    /// <summary>
+    ///     Newest kernel shader model, see <see cref="KernelCompiler.Desc.ShaderModel" />.
+    /// </summary>
+    public readonly KernelShaderModel ShaderModel;
+
+    /// <summary>
+    ///     Universally unique identifier of the adapter, stays the same across processes and driver versions.
+    /// </summary>
+    public unsafe fixed byte DeviceUuid[UuidSize];
+
     /// <summary>
     ///     Get adapter's name as a managed string.
     /// </summary>
@@ -77,6 +77,19 @@ public sealed class DeviceFactory : NativeObject
         IDeviceFactory_Init(Handle, in desc).ThrowOnError("Couldn't initialize Device factory");
     }
 
+    /// <summary>
+    ///     Get capabilities and limits of an adapter.
+    /// </summary>
+    /// <param name="adapterId">ID of the adapter, see <see cref="AdapterInfo.Id" />.</param>
+    /// <returns>The adapter capabilities.</returns>
+    /// <exception cref="ErrorResultException">Unmanaged function returned an error code.</exception>
+    public AdapterCapabilities GetAdapterCapabilities(int adapterId)
+    {
+        IDeviceFactory_GetAdapterCapabilities(Handle, adapterId, out var capabilities)
+            .ThrowOnError("Couldn't get adapter capabilities");
+        return capabilities;
+    }
+
     /// <summary>
     ///     Create a compute device.
     /// </summary>
@@ -128,6 +141,10 @@ public sealed class DeviceFactory : NativeObject
     [DllImport("UnCompute")]
     private static extern void IDeviceFactory_EnumerateAdapters(nint handle, out NativeArray<AdapterInfo> adapters);
 
+    [DllImport("UnCompute")]
+    private static extern ResultCode IDeviceFactory_GetAdapterCapabilities(nint self, int adapterId,
+        out AdapterCapabilities capabilities);
+
     [DllImport("UnCompute")]
     private static extern ResultCode IDeviceFactory_CreateDevice(nint self, out nint device);
 
@@ -138,6 +155,8 @@ public sealed class DeviceFactory : NativeObject
     ///     Device factory descriptor.
     /// </summary>
     /// <param name="ApplicationName">Name of the user application.</param>
+    /// <param name="Profile">Debugging and validation profile.</param>
     [StructLayout(LayoutKind.Sequential, CharSet = CharSet.Ansi)]
-    public readonly record struct Desc(string ApplicationName);
+    public readonly record struct Desc(string ApplicationName,
+        DeviceFactoryProfile Profile = DeviceFactoryProfile.Production);
 }
@@ -0,0 +1,30 @@
+﻿namespace UraniumCompute.Acceleration;
+
+/// <summary>
+///     Debugging and validation profile of a device factory.
+/// </summary>
+/// <remarks>
+///     Validation adds a significant CPU overhead to every backend call, so it should be disabled in production.
+/// </remarks>
+public enum DeviceFactoryProfile
+{
+    /// <summary>
+    ///     No validation and debug callbacks, object debug names are not passed to the backend.
+    /// </summary>
+    Production,
+
+    /// <summary>
+    ///     Standard validation with messages written to the log, object debug names are set.
+    /// </summary>
+    Debug,
+
+    /// <summary>
+    ///     Debug profile plus validation of out-of-bounds accesses inside of kernels.
+    /// </summary>
+    GpuAssistedValidation,
+
+    /// <summary>
+    ///     Debug profile plus validation of missing memory barriers and other hazards.
+    /// </summary>
+    SynchronizationValidation
+}
@@ -0,0 +1,11 @@
+﻿using System.Runtime.InteropServices;
+
+namespace UraniumCompute.Acceleration;
+
+/// <summary>
+///     Description of a device memory heap.
+/// </summary>
+/// <param name="Size">Size of the heap in bytes.</param>
+/// <param name="Kind">Kinds of memory that can be allocated from the heap.</param>
+[StructLayout(LayoutKind.Sequential)]
+public readonly record struct MemoryHeapInfo(ulong Size, MemoryKindFlags Kind);
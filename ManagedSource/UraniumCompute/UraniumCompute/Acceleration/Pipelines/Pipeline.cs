@@ -118,10 +118,9 @@ public sealed class Pipeline : IDisposable
             }
         }
 
-        commandList.Submit();
         var sw = new Stopwatch();
         sw.Start();
-        await Task.Run(() => commandList.CompletionFence.WaitOnCpu());
+        await commandList.SubmitAsync();
         sw.Stop();
         return new Result(sw.ElapsedMilliseconds);
     }
@@ -0,0 +1,50 @@
+﻿namespace UraniumCompute.Acceleration;
+
+/// <summary>
+///     Subgroup (wave) operations that can be used in compute kernels.
+/// </summary>
+[Flags]
+public enum SubgroupOperationFlags
+{
+    None = 0,
+
+    /// <summary>
+    ///     WaveGetLaneIndex, WaveGetLaneCount, WaveIsFirstLane.
+    /// </summary>
+    Basic = 1 << 0,
+
+    /// <summary>
+    ///     WaveActiveAnyTrue, WaveActiveAllTrue, WaveActiveAllEqual.
+    /// </summary>
+    Vote = 1 << 1,
+
+    /// <summary>
+    ///     WaveActiveSum, WaveActiveMin, WavePrefixSum, etc.
+    /// </summary>
+    Arithmetic = 1 << 2,
+
+    /// <summary>
+    ///     WaveActiveBallot, WaveReadLaneFirst, WaveReadLaneAt.
+    /// </summary>
+    Ballot = 1 << 3,
+
+    /// <summary>
+    ///     Arbitrary lane shuffles.
+    /// </summary>
+    Shuffle = 1 << 4,
+
+    /// <summary>
+    ///     Lane shuffles relative to the current lane.
+    /// </summary>
+    ShuffleRelative = 1 << 5,
+
+    /// <summary>
+    ///     Operations on clusters of lanes.
+    /// </summary>
+    Clustered = 1 << 6,
+
+    /// <summary>
+    ///     QuadReadAcrossX, QuadReadAcrossY, etc.
+    /// </summary>
+    Quad = 1 << 7
+}
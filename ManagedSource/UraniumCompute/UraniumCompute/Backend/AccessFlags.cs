@@ -20,7 +20,10 @@ public enum AccessFlags
     HostWrite = 1 << 6,
     HostReadWrite = HostRead | HostWrite,
 
+    IndirectRead = 1 << 7,
+
     All = KernelRead | KernelWrite |
           TransferRead | TransferWrite |
-          HostRead | HostWrite
+          HostRead | HostWrite |
+          IndirectRead
 }
@@ -105,7 +105,12 @@ public class BufferBase : DeviceObject<BufferBase.Desc>
         /// <summary>
         ///     The buffer is used to store kernel constants.
         /// </summary>
-        Constant
+        Constant,
+
+        /// <summary>
+        ///     The buffer is used as a storage and to store indirect dispatch arguments.
+        /// </summary>
+        Indirect
     }
 
     /// <summary>
@@ -9,4 +9,4 @@ namespace UraniumCompute.Backend;
 /// <param name="SourceOffset">Offset in the source buffer.</param>
 /// <param name="DestOffset">Offset in the destination buffer.</param>
 [StructLayout(LayoutKind.Sequential)]
-public readonly record struct BufferCopyRegion(ulong Size, uint SourceOffset = 0, uint DestOffset = 0);
+public readonly record struct BufferCopyRegion(ulong Size, ulong SourceOffset = 0, ulong DestOffset = 0);
@@ -0,0 +1,30 @@
+﻿using System.Runtime.InteropServices;
+
+namespace UraniumCompute.Backend;
+
+/// <summary>
+///     Region for buffer to image and image to buffer copy commands.
+///     The texels are tightly packed in the buffer, rows and slices of the region follow each other without padding.
+/// </summary>
+/// <param name="BufferOffset">Offset in the buffer.</param>
+/// <param name="ImageX">X coordinate of the region in the image.</param>
+/// <param name="ImageY">Y coordinate of the region in the image.</param>
+/// <param name="ImageZ">Z coordinate of the region in the image.</param>
+/// <param name="Width">Width of the region in texels.</param>
+/// <param name="Height">Height of the region in texels.</param>
+/// <param name="Depth">Depth of the region in texels.</param>
+[StructLayout(LayoutKind.Sequential)]
+public readonly record struct BufferImageCopyRegion(ulong BufferOffset, uint ImageX, uint ImageY, uint ImageZ, uint Width,
+    uint Height, uint Depth)
+{
+    /// <summary>
+    ///     Create a region that starts at the origin of the image and at the beginning of the buffer.
+    /// </summary>
+    /// <param name="width">Width of the region in texels.</param>
+    /// <param name="height">Height of the region in texels.</param>
+    /// <param name="depth">Depth of the region in texels.</param>
+    public BufferImageCopyRegion(uint width, uint height = 1, uint depth = 1)
+        : this(0, 0, 0, 0, width, height, depth)
+    {
+    }
+}
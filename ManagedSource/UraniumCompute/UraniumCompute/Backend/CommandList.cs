@@ -32,6 +32,10 @@ public sealed class CommandList : DeviceObject<CommandList.Desc>
 
     private Fence? fence;
 
+    // The delegate is kept in a static field, so that it's never collected while the native code holds the pointer.
+    private static readonly CompletionCallback completionCallback = OnSubmissionCompleted;
+    private static readonly nint completionCallbackPointer = Marshal.GetFunctionPointerForDelegate(completionCallback);
+
     internal CommandList(nint handle) : base(handle)
     {
     }
@@ -61,6 +65,62 @@ public sealed class CommandList : DeviceObject<CommandList.Desc>
         ICommandList_Submit(Handle).ThrowOnError("Couldn't submit command list for execution");
     }
 
+    /// <summary>
+    ///     Submit the command list and get a task that completes when the submitted work is done.
+    /// </summary>
+    /// <remarks>
+    ///     Unlike waiting for the <see cref="CompletionFence" />, this doesn't block a thread pool thread: the task is
+    ///     completed by the device's completion thread. The command list must not be disposed, reset or submitted
+    ///     again until the task completes.
+    /// </remarks>
+    /// <returns>A task that completes when the command list has been executed.</returns>
+    public Task SubmitAsync()
+    {
+        var completionSource = new TaskCompletionSource(TaskCreationOptions.RunContinuationsAsynchronously);
+        var handle = GCHandle.Alloc(completionSource);
+        var result = ICommandList_SubmitWithCallback(Handle, completionCallbackPointer, GCHandle.ToIntPtr(handle));
+        if (result != ResultCode.Success)
+        {
+            handle.Free();
+        }
+
+        result.ThrowOnError("Couldn't submit command list for execution");
+        return completionSource.Task;
+    }
+
+    private static void OnSubmissionCompleted(nint commandList, ResultCode result, nint userData)
+    {
+        var handle = GCHandle.FromIntPtr(userData);
+        var completionSource = (TaskCompletionSource)handle.Target!;
+        handle.Free();
+
+        if (result == ResultCode.Success)
+        {
+            completionSource.SetResult();
+        }
+        else
+        {
+            completionSource.SetException(new ErrorResultException("Error while waiting for a command list", result));
+        }
+    }
+
+    /// <summary>
+    ///     Get the timestamps written by the last execution of the command list in nanoseconds.
+    ///     The command list must not be pending. Only differences between the timestamps are meaningful.
+    /// </summary>
+    /// <param name="timestamps">
+    ///     A span where the first timestamps will be written, its length must not exceed <see cref="Desc.TimestampQueryCount" />.
+    /// </param>
+    /// <exception cref="ErrorResultException">Unmanaged function returned an error code.</exception>
+    public unsafe void GetTimestamps(Span<ulong> timestamps)
+    {
+        fixed (ulong* pTimestamps = timestamps)
+        {
+            ICommandList_GetTimestamps(Handle, pTimestamps, (ulong)timestamps.Length)
+                .ThrowOnError("Couldn't get command list timestamps");
+        }
+    }
+
     protected override void InitInternal(in Desc desc)
     {
         ICommandList_Init(Handle, in desc);
@@ -89,6 +149,15 @@ public sealed class CommandList : DeviceObject<CommandList.Desc>
     [DllImport("UnCompute")]
     private static extern ResultCode ICommandList_Submit(nint self);
 
+    [DllImport("UnCompute")]
+    private static extern ResultCode ICommandList_SubmitWithCallback(nint self, nint callback, nint userData);
+
+    [DllImport("UnCompute")]
+    private static extern unsafe ResultCode ICommandList_GetTimestamps(nint self, ulong* timestamps, ulong count);
+
+    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+    private delegate void CompletionCallback(nint commandList, ResultCode result, nint userData);
+
     [StructLayout(LayoutKind.Sequential)]
     private readonly struct NativeBuilder
     {
@@ -112,16 +181,59 @@ public sealed class CommandList : DeviceObject<CommandList.Desc>
             CommandListBuilder_MemoryBarrier(ref builder, buffer.Handle, in barrierDesc);
         }
 
+        public void MemoryBarrier(Image image, in MemoryBarrierDesc barrierDesc)
+        {
+            CommandListBuilder_ImageMemoryBarrier(ref builder, image.Handle, in barrierDesc);
+        }
+
         public void CopyUnsafe(BufferBase source, BufferBase destination, in BufferCopyRegion region)
         {
             CommandListBuilder_Copy(ref builder, source.Handle, destination.Handle, in region);
         }
 
+        public unsafe void CopyUnsafe(BufferBase source, BufferBase destination, ReadOnlySpan<BufferCopyRegion> regions)
+        {
+            fixed (BufferCopyRegion* ptr = regions)
+            {
+                CommandListBuilder_CopyRegions(ref builder, source.Handle, destination.Handle, ptr, (ulong)regions.Length);
+            }
+        }
+
+        public void Copy(BufferBase source, Image destination, in BufferImageCopyRegion region)
+        {
+            CommandListBuilder_CopyBufferToImage(ref builder, source.Handle, destination.Handle, in region);
+        }
+
+        public void Copy(Image source, BufferBase destination, in BufferImageCopyRegion region)
+        {
+            CommandListBuilder_CopyImageToBuffer(ref builder, source.Handle, destination.Handle, in region);
+        }
+
+        public void FillUnsafe(BufferBase buffer, ulong offset, ulong size, uint value)
+        {
+            CommandListBuilder_Fill(ref builder, buffer.Handle, offset, size, value);
+        }
+
+        public void UpdateUnsafe(BufferBase buffer, ulong offset, nint data, ulong size)
+        {
+            CommandListBuilder_Update(ref builder, buffer.Handle, offset, data, size);
+        }
+
         public void Dispatch(Kernel kernel, int x, int y, int z)
         {
             CommandListBuilder_Dispatch(ref builder, kernel.Handle, x, y, z);
         }
 
+        public void DispatchIndirectUnsafe(Kernel kernel, BufferBase argsBuffer, ulong offset)
+        {
+            CommandListBuilder_DispatchIndirect(ref builder, kernel.Handle, argsBuffer.Handle, offset);
+        }
+
+        public void WriteTimestamp(uint index)
+        {
+            CommandListBuilder_WriteTimestamp(ref builder, index);
+        }
+
         public void End()
         {
             CommandListBuilder_End(ref builder);
@@ -143,8 +255,39 @@ public sealed class CommandList : DeviceObject<CommandList.Desc>
         private static extern void CommandListBuilder_Copy(ref NativeBuilder self, nint source, nint destination,
             in BufferCopyRegion region);
 
+        [DllImport("UnCompute")]
+        private static extern unsafe void CommandListBuilder_CopyRegions(ref NativeBuilder self, nint source, nint destination,
+            BufferCopyRegion* regions, ulong regionCount);
+
+        [DllImport("UnCompute")]
+        private static extern void CommandListBuilder_ImageMemoryBarrier(ref NativeBuilder self, nint image,
+            in MemoryBarrierDesc barrierDesc);
+
+        [DllImport("UnCompute")]
+        private static extern void CommandListBuilder_CopyBufferToImage(ref NativeBuilder self, nint source, nint destination,
+            in BufferImageCopyRegion region);
+
+        [DllImport("UnCompute")]
+        private static extern void CommandListBuilder_CopyImageToBuffer(ref NativeBuilder self, nint source, nint destination,
+            in BufferImageCopyRegion region);
+
+        [DllImport("UnCompute")]
+        private static extern void CommandListBuilder_Fill(ref NativeBuilder self, nint buffer, ulong offset, ulong size,
+            uint value);
+
+        [DllImport("UnCompute")]
+        private static extern void CommandListBuilder_Update(ref NativeBuilder self, nint buffer, ulong offset, nint data,
+            ulong size);
+
         [DllImport("UnCompute")]
         private static extern void CommandListBuilder_Dispatch(ref NativeBuilder self, nint kernel, int x, int y, int z);
+
+        [DllImport("UnCompute")]
+        private static extern void CommandListBuilder_DispatchIndirect(ref NativeBuilder self, nint kernel, nint argsBuffer,
+            ulong offset);
+
+        [DllImport("UnCompute")]
+        private static extern void CommandListBuilder_WriteTimestamp(ref NativeBuilder self, uint index);
     }
 
     /// <summary>
@@ -153,7 +296,11 @@ public sealed class CommandList : DeviceObject<CommandList.Desc>
     /// <param name="Name">Command list debug name.</param>
     /// <param name="QueueKindFlags">Command queue kind flags.</param>
     /// <param name="Flags">Command list flags.</param>
+    /// <param name="TimestampQueryCount">
+    ///     Number of timestamps that can be written with <see cref="ICommandRecordingContext.WriteTimestamp" />,
+    ///     must be zero if the adapter doesn't support timestamps.
+    /// </param>
     [StructLayout(LayoutKind.Sequential)]
     public readonly record struct Desc(NativeString Name, HardwareQueueKindFlags QueueKindFlags,
-        CommandListFlags Flags = CommandListFlags.None) : IDeviceObjectDescriptor;
+        CommandListFlags Flags = CommandListFlags.None, uint TimestampQueryCount = 0) : IDeviceObjectDescriptor;
 }
@@ -31,6 +31,27 @@ public sealed class ComputeDevice : NativeObject
         IComputeDevice_Init(Handle, in desc).ThrowOnError("Couldn't initialize Compute device");
     }
 
+    /// <summary>
+    ///     Get current memory budget and usage of the device.
+    /// </summary>
+    /// <returns>The memory budget.</returns>
+    /// <exception cref="ErrorResultException">Unmanaged function returned an error code.</exception>
+    public MemoryBudget GetMemoryBudget()
+    {
+        IComputeDevice_GetMemoryBudget(Handle, out var budget).ThrowOnError("Couldn't get memory budget");
+        return budget;
+    }
+
+    /// <summary>
+    ///     Get information about the adapter the device was created on.
+    /// </summary>
+    /// <returns>The adapter information.</returns>
+    public AdapterInfo GetAdapterInfo()
+    {
+        IComputeDevice_GetAdapterInfo(Handle, out var info);
+        return info;
+    }
+
     /// <summary>
     ///     Create <see cref="DeviceMemory" /> object.
     /// </summary>
@@ -90,6 +111,34 @@ public sealed class ComputeDevice : NativeObject
         };
     }
 
+    /// <summary>
+    ///     Create <see cref="Image" /> object.
+    /// </summary>
+    /// <returns>The created object.</returns>
+    /// <exception cref="ErrorResultException">The object was not created successfully.</exception>
+    public Image CreateImage()
+    {
+        return IComputeDevice_CreateImage(Handle, out var image) switch
+        {
+            ResultCode.Success => new Image(image),
+            var resultCode => throw new ErrorResultException("Couldn't create image", resultCode)
+        };
+    }
+
+    /// <summary>
+    ///     Create <see cref="Sampler" /> object.
+    /// </summary>
+    /// <returns>The created object.</returns>
+    /// <exception cref="ErrorResultException">The object was not created successfully.</exception>
+    public Sampler CreateSampler()
+    {
+        return IComputeDevice_CreateSampler(Handle, out var sampler) switch
+        {
+            ResultCode.Success => new Sampler(sampler),
+            var resultCode => throw new ErrorResultException("Couldn't create sampler", resultCode)
+        };
+    }
+
     /// <summary>
     ///     Create <see cref="Fence" /> object.
     /// </summary>
@@ -161,9 +210,21 @@ public sealed class ComputeDevice : NativeObject
     [DllImport("UnCompute")]
     private static extern ResultCode IComputeDevice_Init(nint self, in Desc desc);
 
+    [DllImport("UnCompute")]
+    private static extern ResultCode IComputeDevice_GetMemoryBudget(nint self, out MemoryBudget budget);
+
+    [DllImport("UnCompute")]
+    private static extern void IComputeDevice_GetAdapterInfo(nint self, out AdapterInfo info);
+
     [DllImport("UnCompute")]
     private static extern ResultCode IComputeDevice_CreateBuffer(nint self, out nint buffer);
 
+    [DllImport("UnCompute")]
+    private static extern ResultCode IComputeDevice_CreateImage(nint self, out nint image);
+
+    [DllImport("UnCompute")]
+    private static extern ResultCode IComputeDevice_CreateSampler(nint self, out nint sampler);
+
     [DllImport("UnCompute")]
     private static extern ResultCode IComputeDevice_CreateMemory(nint self, out nint memory);
 
@@ -183,6 +244,10 @@ public sealed class ComputeDevice : NativeObject
     ///     Compute device descriptor.
     /// </summary>
     /// <param name="AdapterId">ID of the adapter to create the device on.</param>
+    /// <param name="RequiredFeatures">
+    ///     Optional features to enable, device creation fails if any are not supported.
+    ///     See <see cref="AdapterInfo.SupportedFeatures" />.
+    /// </param>
     [StructLayout(LayoutKind.Sequential)]
-    public readonly record struct Desc(int AdapterId);
+    public readonly record struct Desc(int AdapterId, DeviceFeatureFlags RequiredFeatures = DeviceFeatureFlags.None);
 }
@@ -0,0 +1,53 @@
+﻿namespace UraniumCompute.Backend;
+
+/// <summary>
+///     Optional device features that kernels can use.
+/// </summary>
+[Flags]
+public enum DeviceFeatureFlags
+{
+    /// <summary>
+    ///     No optional features.
+    /// </summary>
+    None = 0,
+
+    /// <summary>
+    ///     16-bit floating point arithmetic (float16_t, half).
+    /// </summary>
+    Float16 = 1 << 0,
+
+    /// <summary>
+    ///     64-bit floating point arithmetic (double).
+    /// </summary>
+    Float64 = 1 << 1,
+
+    /// <summary>
+    ///     8-bit integer arithmetic.
+    /// </summary>
+    Int8 = 1 << 2,
+
+    /// <summary>
+    ///     16-bit integer arithmetic (int16_t, uint16_t).
+    /// </summary>
+    Int16 = 1 << 3,
+
+    /// <summary>
+    ///     64-bit integer arithmetic (int64_t, uint64_t).
+    /// </summary>
+    Int64 = 1 << 4,
+
+    /// <summary>
+    ///     16-bit types in storage and uniform buffers.
+    /// </summary>
+    Storage16Bit = 1 << 5,
+
+    /// <summary>
+    ///     8-bit types in storage and uniform buffers.
+    /// </summary>
+    Storage8Bit = 1 << 6,
+
+    /// <summary>
+    ///     64-bit atomic operations on buffers (InterlockedAdd on uint64_t, etc.).
+    /// </summary>
+    Int64Atomics = 1 << 7
+}
@@ -85,6 +85,21 @@ public sealed class Fence : DeviceObject<Fence.Desc>
         return IFence_WaitOnCpu_Timeout(Handle, (ulong)(timeout.TotalMilliseconds * 1_000_000));
     }
 
+    /// <summary>
+    ///     Export a Linux file descriptor that becomes readable when the fence is signaled.
+    /// </summary>
+    /// <remarks>
+    ///     The descriptor can be added to poll, epoll or io_uring to wait for many submissions without
+    ///     blocking a thread per fence. The caller owns the descriptor and must close it. The command list that
+    ///     signals the fence must already be submitted.
+    /// </remarks>
+    /// <returns>The exported file descriptor.</returns>
+    public int ExportCompletionFd()
+    {
+        IFence_ExportCompletionFd(Handle, out var fileDescriptor).ThrowOnError("Couldn't export a fence file descriptor");
+        return fileDescriptor;
+    }
+
     protected override void InitInternal(in Desc desc)
     {
         IFence_Init(Handle, in desc);
@@ -111,6 +126,9 @@ public sealed class Fence : DeviceObject<Fence.Desc>
     [DllImport("UnCompute")]
     private static extern FenceState IFence_GetState(nint self);
 
+    [DllImport("UnCompute")]
+    private static extern ResultCode IFence_ExportCompletionFd(nint self, out int fileDescriptor);
+
     /// <summary>
     ///     Fence descriptor.
     /// </summary>
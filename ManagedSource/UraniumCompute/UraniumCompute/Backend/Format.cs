@@ -0,0 +1,52 @@
+﻿namespace UraniumCompute.Backend;
+
+/// <summary>
+///     Format of texels stored in typed buffers and images.
+///     The data is converted by the hardware when accessed by a kernel.
+/// </summary>
+public enum Format
+{
+    /// <summary>
+    ///     Invalid or unspecified format.
+    /// </summary>
+    None,
+
+    R8_UNorm,
+    R8_SNorm,
+    R8_UInt,
+    R8_SInt,
+    R8G8_UNorm,
+    R8G8_SNorm,
+    R8G8_UInt,
+    R8G8_SInt,
+    R8G8B8A8_UNorm,
+    R8G8B8A8_SNorm,
+    R8G8B8A8_UInt,
+    R8G8B8A8_SInt,
+
+    R16_UNorm,
+    R16_SNorm,
+    R16_UInt,
+    R16_SInt,
+    R16_SFloat,
+    R16G16_UNorm,
+    R16G16_SNorm,
+    R16G16_UInt,
+    R16G16_SInt,
+    R16G16_SFloat,
+    R16G16B16A16_UNorm,
+    R16G16B16A16_SNorm,
+    R16G16B16A16_UInt,
+    R16G16B16A16_SInt,
+    R16G16B16A16_SFloat,
+
+    R32_UInt,
+    R32_SInt,
+    R32_SFloat,
+    R32G32_UInt,
+    R32G32_SInt,
+    R32G32_SFloat,
+    R32G32B32A32_UInt,
+    R32G32B32A32_SInt,
+    R32G32B32A32_SFloat
+}
@@ -27,6 +27,13 @@ public interface ICommandRecordingContext : IDisposable
     /// <param name="barrierDesc">The barrier descriptor.</param>
     void MemoryBarrierUnsafe(BufferBase buffer, in MemoryBarrierDesc barrierDesc);
 
+    /// <summary>
+    ///     Insert a memory dependency.
+    /// </summary>
+    /// <param name="image">The image affected by the barrier.</param>
+    /// <param name="barrierDesc">The barrier descriptor.</param>
+    void MemoryBarrier(Image image, in MemoryBarrierDesc barrierDesc);
+
     /// <summary>
     ///     Insert a memory dependency.
     /// </summary>
@@ -79,9 +86,100 @@ public interface ICommandRecordingContext : IDisposable
     /// <param name="region">Copy region.</param>
     void CopyUnsafe(BufferBase source, BufferBase destination, in BufferCopyRegion region);
 
+    /// <summary>
+    ///     Copy multiple regions of the source buffer to the destination buffer in a single command.
+    /// </summary>
+    /// <param name="source">Source buffer.</param>
+    /// <param name="destination">Destination buffer.</param>
+    /// <param name="regions">Copy regions, must not be empty.</param>
+    /// <typeparam name="T">Type of the elements stored in the buffers.</typeparam>
+    void Copy<T>(Buffer<T> source, Buffer<T> destination, ReadOnlySpan<BufferCopyRegion> regions)
+        where T : unmanaged
+    {
+        CopyUnsafe(source, destination, regions);
+    }
+
+    /// <summary>
+    ///     A not type-safe version of multi-region buffer copy command.
+    /// </summary>
+    /// <param name="source">Source buffer.</param>
+    /// <param name="destination">Destination buffer.</param>
+    /// <param name="regions">Copy regions, must not be empty.</param>
+    void CopyUnsafe(BufferBase source, BufferBase destination, ReadOnlySpan<BufferCopyRegion> regions);
+
+    /// <summary>
+    ///     Copy a region of the buffer to the image.
+    /// </summary>
+    /// <param name="source">Source buffer.</param>
+    /// <param name="destination">Destination image.</param>
+    /// <param name="region">Copy region.</param>
+    void Copy(BufferBase source, Image destination, in BufferImageCopyRegion region);
+
+    /// <summary>
+    ///     Copy a region of the image to the buffer.
+    /// </summary>
+    /// <param name="source">Source image.</param>
+    /// <param name="destination">Destination buffer.</param>
+    /// <param name="region">Copy region.</param>
+    void Copy(Image source, BufferBase destination, in BufferImageCopyRegion region);
+
+    /// <summary>
+    ///     Fill the whole buffer with a repeated 32-bit value on the device.
+    /// </summary>
+    /// <param name="buffer">The buffer to fill.</param>
+    /// <param name="value">The 32-bit value to fill the buffer with.</param>
+    /// <typeparam name="T">Type of the elements stored in the buffer.</typeparam>
+    void Fill<T>(Buffer<T> buffer, uint value)
+        where T : unmanaged
+    {
+        FillUnsafe(buffer, 0, DeviceMemory.WholeSize, value);
+    }
+
+    /// <summary>
+    ///     A not type-safe version of buffer fill command.
+    /// </summary>
+    /// <param name="buffer">The buffer to fill.</param>
+    /// <param name="offset">Byte offset of the region to fill, must be a multiple of 4.</param>
+    /// <param name="size">
+    ///     Size of the region to fill in bytes, must be a multiple of 4 or <see cref="DeviceMemory.WholeSize" />.
+    /// </param>
+    /// <param name="value">The 32-bit value to fill the region with.</param>
+    void FillUnsafe(BufferBase buffer, ulong offset, ulong size, uint value);
+
+    /// <summary>
+    ///     Write a small amount of data to the buffer inline with the command list.
+    /// </summary>
+    /// <param name="buffer">The buffer to update.</param>
+    /// <param name="data">
+    ///     The data to write, its size in bytes must be a multiple of 4 and not greater than 65536.
+    /// </param>
+    /// <param name="startIndex">Index of the first buffer element to update.</param>
+    /// <typeparam name="T">Type of the elements stored in the buffer.</typeparam>
+    unsafe void Update<T>(Buffer<T> buffer, ReadOnlySpan<T> data, int startIndex = 0)
+        where T : unmanaged
+    {
+        fixed (T* ptr = data)
+        {
+            UpdateUnsafe(buffer, (ulong)startIndex * (ulong)sizeof(T), (nint)ptr, (ulong)data.Length * (ulong)sizeof(T));
+        }
+    }
+
+    /// <summary>
+    ///     A not type-safe version of buffer update command.
+    /// </summary>
+    /// <param name="buffer">The buffer to update.</param>
+    /// <param name="offset">Byte offset of the region to update, must be a multiple of 4.</param>
+    /// <param name="data">Pointer to the data to write to the buffer.</param>
+    /// <param name="size">Size of the data in bytes, must be a non-zero multiple of 4 not greater than 65536.</param>
+    void UpdateUnsafe(BufferBase buffer, ulong offset, nint data, ulong size);
+
     /// <summary>
     ///     Dispatch a compute kernel to execute on the device.
     /// </summary>
+    /// <remarks>
+    ///     The workgroup counts must not exceed <see cref="AdapterInfo.MaxWorkgroupCount" />. An oversize dispatch is not
+    ///     recorded and the following submission of the command list fails with <see cref="ResultCode.InvalidArguments" />.
+    /// </remarks>
     /// <param name="kernel">The kernel to dispatch.</param>
     /// <param name="x">The number of local workgroups to dispatch in the X dimension.</param>
     /// <param name="y">The number of local workgroups to dispatch in the Y dimension.</param>
@@ -98,6 +196,34 @@ public interface ICommandRecordingContext : IDisposable
         Dispatch(kernel, workgroups.X, workgroups.Y, workgroups.Z);
     }
 
+    /// <summary>
+    ///     Dispatch a compute kernel with the workgroup counts read from a buffer on the device.
+    /// </summary>
+    /// <param name="kernel">The kernel to dispatch.</param>
+    /// <param name="argsBuffer">
+    ///     The buffer created with <see cref="BufferBase.Usage.Indirect" /> that stores the workgroup counts.
+    /// </param>
+    /// <param name="offset">Byte offset of the workgroup counts in the buffer, must be a multiple of 4.</param>
+    void DispatchIndirect(Kernel kernel, Buffer<Vector3Uint> argsBuffer, ulong offset = 0)
+    {
+        DispatchIndirectUnsafe(kernel, argsBuffer, offset);
+    }
+
+    /// <summary>
+    ///     A not type-safe version of indirect dispatch command.
+    /// </summary>
+    /// <param name="kernel">The kernel to dispatch.</param>
+    /// <param name="argsBuffer">The buffer that stores the workgroup counts.</param>
+    /// <param name="offset">Byte offset of the workgroup counts in the buffer, must be a multiple of 4.</param>
+    void DispatchIndirectUnsafe(Kernel kernel, BufferBase argsBuffer, ulong offset);
+
+    /// <summary>
+    ///     Write the device time to a timestamp query once all the previously recorded commands are complete.
+    ///     The values can be read with <see cref="CommandList.GetTimestamps" /> after the command list is executed.
+    /// </summary>
+    /// <param name="index">Index of the query, must be less than <see cref="CommandList.Desc.TimestampQueryCount" />.</param>
+    void WriteTimestamp(uint index);
+
     /// <summary>
     ///     Set the command list state to Executable and end command recording.
     /// </summary>
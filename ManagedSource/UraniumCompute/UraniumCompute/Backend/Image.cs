@@ -0,0 +1,149 @@
+﻿using System.Runtime.InteropServices;
+using UraniumCompute.Acceleration;
+using UraniumCompute.Memory;
+
+namespace UraniumCompute.Backend;
+
+/// <summary>
+///     Encapsulates backend-specific images that store 1D, 2D or 3D texel data on the device.
+///     Unlike buffers, images can use tiled memory layouts and texture caches.
+/// </summary>
+public sealed class Image : DeviceObject<Image.Desc>
+{
+    public override Desc Descriptor
+    {
+        get
+        {
+            IImage_GetDesc(Handle, out var value);
+            return value;
+        }
+    }
+
+    /// <summary>
+    ///     The memory bound to this image.
+    /// </summary>
+    public DeviceMemorySlice BoundMemory { get; private set; }
+
+    internal Image(nint handle) : base(handle)
+    {
+    }
+
+    /// <summary>
+    ///     Allocate memory compatible with this image.
+    /// </summary>
+    /// <param name="memoryDebugName">Debug name that will be set to the allocated device memory.</param>
+    /// <param name="flags"><see cref="MemoryKindFlags" /> to allocate the memory with.</param>
+    /// <returns>The allocated device memory.</returns>
+    public DeviceMemory AllocateMemory(NativeString memoryDebugName, MemoryKindFlags flags)
+    {
+        ReadOnlySpan<nint> handle = stackalloc nint[] { Handle };
+        var memory = Device.CreateMemory();
+        memory.Init(new DeviceMemory.Desc(memoryDebugName, 0, handle, flags));
+        return memory;
+    }
+
+    /// <summary>
+    ///     Bind device memory slice to this image.
+    /// </summary>
+    /// <param name="memorySlice">Memory slice to bind.</param>
+    public void BindMemory(in DeviceMemorySlice memorySlice)
+    {
+        BoundMemory = memorySlice;
+        var sliceNative = new DeviceMemorySliceNative(memorySlice.Memory.Handle, memorySlice.Offset, memorySlice.Size);
+        IImage_BindMemory(Handle, sliceNative).ThrowOnError("Couldn't bind memory to image");
+    }
+
+    /// <summary>
+    ///     Bind device memory to this image.
+    /// </summary>
+    /// <param name="memory">Memory to bind.</param>
+    public void BindMemory(DeviceMemory memory)
+    {
+        BindMemory(new DeviceMemorySlice(memory));
+    }
+
+    protected override void InitInternal(in Desc desc)
+    {
+        IImage_Init(Handle, in desc).ThrowOnError("Couldn't initialize image");
+    }
+
+    [DllImport("UnCompute")]
+    private static extern ResultCode IImage_Init(nint self, in Desc desc);
+
+    [DllImport("UnCompute")]
+    private static extern void IImage_GetDesc(nint self, out Desc desc);
+
+    [DllImport("UnCompute")]
+    private static extern ResultCode IImage_BindMemory(nint self, in DeviceMemorySliceNative slice);
+
+    [StructLayout(LayoutKind.Sequential)]
+    private readonly record struct DeviceMemorySliceNative(nint Memory, ulong Offset, ulong Size);
+
+    /// <summary>
+    ///     Number of image dimensions.
+    /// </summary>
+    public enum Dimension
+    {
+        /// <summary>
+        ///     One-dimensional image.
+        /// </summary>
+        Image1D,
+
+        /// <summary>
+        ///     Two-dimensional image.
+        /// </summary>
+        Image2D,
+
+        /// <summary>
+        ///     Three-dimensional image.
+        /// </summary>
+        Image3D
+    }
+
+    /// <summary>
+    ///     Image usage flags, images can always be used as a source and a destination of copy commands.
+    /// </summary>
+    [Flags]
+    public enum UsageFlags
+    {
+        None = 0,
+
+        /// <summary>
+        ///     The image can be bound as <see cref="KernelResourceKind.SampledTexture" />.
+        /// </summary>
+        Sampled = 1 << 0,
+
+        /// <summary>
+        ///     The image can be bound as <see cref="KernelResourceKind.RWTexture" />.
+        /// </summary>
+        Storage = 1 << 1
+    }
+
+    /// <summary>
+    ///     Image descriptor.
+    /// </summary>
+    /// <param name="Name">Debug name of the object.</param>
+    /// <param name="ImageDimension">Number of image dimensions.</param>
+    /// <param name="Format">Format of image texels.</param>
+    /// <param name="Width">Image width in texels.</param>
+    /// <param name="Height">Image height in texels, must be 1 for 1D images.</param>
+    /// <param name="Depth">Image depth in texels, must be 1 for 1D and 2D images.</param>
+    /// <param name="Usage">Image usage flags.</param>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly record struct Desc(NativeString Name, Dimension ImageDimension, Format Format, uint Width, uint Height,
+        uint Depth, UsageFlags Usage) : IDeviceObjectDescriptor
+    {
+        /// <summary>
+        ///     Create a descriptor of a 2D image.
+        /// </summary>
+        /// <param name="name">Debug name of the object.</param>
+        /// <param name="format">Format of image texels.</param>
+        /// <param name="width">Image width in texels.</param>
+        /// <param name="height">Image height in texels.</param>
+        /// <param name="usage">Image usage flags.</param>
+        public Desc(NativeString name, Format format, uint width, uint height, UsageFlags usage = UsageFlags.Storage)
+            : this(name, Dimension.Image2D, format, width, height, 1, usage)
+        {
+        }
+    }
+}
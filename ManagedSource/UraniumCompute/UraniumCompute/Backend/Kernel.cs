@@ -19,6 +19,18 @@ public sealed class Kernel : DeviceObject<Kernel.Desc>
         }
     }
 
+    /// <summary>
+    ///     Workgroup size declared in the kernel bytecode.
+    /// </summary>
+    public WorkgroupSize WorkgroupSize
+    {
+        get
+        {
+            IKernel_GetWorkgroupSize(Handle, out var value);
+            return value;
+        }
+    }
+
     internal Kernel(nint handle) : base(handle)
     {
     }
@@ -34,6 +46,9 @@ public sealed class Kernel : DeviceObject<Kernel.Desc>
     [DllImport("UnCompute")]
     private static extern void IKernel_GetDesc(nint self, out Desc desc);
 
+    [DllImport("UnCompute")]
+    private static extern void IKernel_GetWorkgroupSize(nint self, out WorkgroupSize size);
+
     /// <summary>
     ///     Kernel descriptor.
     /// </summary>
@@ -71,8 +86,20 @@ public sealed class Kernel : DeviceObject<Kernel.Desc>
             }
         }
 
+        /// <summary>
+        ///     Number of invocations in a subgroup (wave) the kernel must be run with, zero to let the driver choose.
+        ///     Must be a power of two in range [<see cref="AdapterInfo.MinSubgroupSize" />,
+        ///     <see cref="AdapterInfo.MaxSubgroupSize" />].
+        /// </summary>
+        public uint RequiredSubgroupSize
+        {
+            get => requiredSubgroupSize;
+            init => requiredSubgroupSize = value;
+        }
+
         private readonly nint resourceBinding;
         private readonly ArraySliceBase bytecode;
+        private readonly uint requiredSubgroupSize;
 
         /// <summary>
         ///     Kernel descriptor.
@@ -85,6 +112,7 @@ public sealed class Kernel : DeviceObject<Kernel.Desc>
             Name = name;
             this.resourceBinding = resourceBinding.Handle;
             this.bytecode = new ArraySliceBase();
+            requiredSubgroupSize = 0;
             Bytecode = bytecode;
         }
     }
@@ -7,5 +7,8 @@ namespace UraniumCompute.Backend;
 /// </summary>
 /// <param name="BindingIndex">Binding index in the compute shader source.</param>
 /// <param name="Kind">Kind of resource that is bound to a kernel.</param>
+/// <param name="Format">
+///     Texel format of a typed buffer, must be <see cref="Backend.Format.None" /> for structured and byte address buffers.
+/// </param>
 [StructLayout(LayoutKind.Sequential)]
-public readonly record struct KernelResourceDesc(int BindingIndex, KernelResourceKind Kind);
+public readonly record struct KernelResourceDesc(int BindingIndex, KernelResourceKind Kind, Format Format = Format.None);
@@ -0,0 +1,52 @@
+﻿using System.Runtime.InteropServices;
+using UraniumCompute.Acceleration;
+
+namespace UraniumCompute.Backend;
+
+/// <summary>
+///     Memory budget and usage of a single device memory heap.
+/// </summary>
+/// <param name="Budget">Estimated amount of memory the process can allocate from the heap without failures.</param>
+/// <param name="Usage">Estimated amount of memory currently used by the process, including other APIs.</param>
+/// <param name="AllocatedBytes">Number of bytes allocated from the heap through the device's memory objects.</param>
+[StructLayout(LayoutKind.Sequential)]
+public readonly record struct MemoryHeapBudget(ulong Budget, ulong Usage, ulong AllocatedBytes);
+
+/// <summary>
+///     Memory budget and usage of all device memory heaps.
+///     The heaps are in the same order as in <see cref="AdapterCapabilities.GetMemoryHeap" />.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct MemoryBudget
+{
+    /// <summary>
+    ///     Sum of <see cref="MemoryHeapBudget.AllocatedBytes" /> of all heaps.
+    /// </summary>
+    public readonly ulong TotalAllocatedBytes;
+
+    /// <summary>
+    ///     Number of memory heaps.
+    /// </summary>
+    /// <seealso cref="GetHeap" />
+    public readonly int HeapCount;
+
+    private unsafe fixed ulong heaps[AdapterCapabilities.MaxMemoryHeaps * 3];
+
+    /// <summary>
+    ///     Get budget and usage of a device memory heap.
+    /// </summary>
+    /// <param name="index">Index of the heap, must be less than <see cref="HeapCount" />.</param>
+    /// <returns>The heap budget.</returns>
+    public unsafe MemoryHeapBudget GetHeap(int index)
+    {
+        if ((uint)index >= (uint)HeapCount)
+        {
+            throw new ArgumentOutOfRangeException(nameof(index));
+        }
+
+        fixed (ulong* ptr = heaps)
+        {
+            return ((MemoryHeapBudget*)ptr)[index];
+        }
+    }
+}
@@ -47,6 +47,26 @@ public sealed class ResourceBinding : DeviceObject<ResourceBinding.Desc>
         SetVariableInternal(bindingIndex, buffer);
     }
 
+    /// <summary>
+    ///     Set kernel variable.
+    /// </summary>
+    /// <param name="bindingIndex">Binding index of the variable to set.</param>
+    /// <param name="image">The image to assign, the variable must be a SampledTexture or a RWTexture.</param>
+    public void SetVariable(int bindingIndex, Image image)
+    {
+        IResourceBinding_SetImage(Handle, bindingIndex, image.Handle).ThrowOnError("Couldn't set kernel variable");
+    }
+
+    /// <summary>
+    ///     Set kernel variable.
+    /// </summary>
+    /// <param name="bindingIndex">Binding index of the variable to set.</param>
+    /// <param name="sampler">The sampler to assign, the variable must be a Sampler.</param>
+    public void SetVariable(int bindingIndex, Sampler sampler)
+    {
+        IResourceBinding_SetSampler(Handle, bindingIndex, sampler.Handle).ThrowOnError("Couldn't set kernel variable");
+    }
+
     internal void SetVariableInternal(int bindingIndex, BufferBase value)
     {
         IResourceBinding_SetVariable(Handle, bindingIndex, value.Handle).ThrowOnError("Couldn't set kernel variable");
@@ -66,6 +86,12 @@ public sealed class ResourceBinding : DeviceObject<ResourceBinding.Desc>
     [DllImport("UnCompute")]
     private static extern ResultCode IResourceBinding_SetVariable(nint self, int bindingIndex, nint buffer);
 
+    [DllImport("UnCompute")]
+    private static extern ResultCode IResourceBinding_SetImage(nint self, int bindingIndex, nint image);
+
+    [DllImport("UnCompute")]
+    private static extern ResultCode IResourceBinding_SetSampler(nint self, int bindingIndex, nint sampler);
+
     /// <summary>
     ///     Resource binding descriptor.
     /// </summary>
@@ -0,0 +1,93 @@
+﻿using System.Runtime.InteropServices;
+using UraniumCompute.Acceleration;
+using UraniumCompute.Memory;
+
+namespace UraniumCompute.Backend;
+
+/// <summary>
+///     Texture samplers that are used by kernels to read sampled images.
+/// </summary>
+public sealed class Sampler : DeviceObject<Sampler.Desc>
+{
+    public override Desc Descriptor
+    {
+        get
+        {
+            ISampler_GetDesc(Handle, out var value);
+            return value;
+        }
+    }
+
+    internal Sampler(nint handle) : base(handle)
+    {
+    }
+
+    protected override void InitInternal(in Desc desc)
+    {
+        ISampler_Init(Handle, in desc).ThrowOnError("Couldn't initialize sampler");
+    }
+
+    [DllImport("UnCompute")]
+    private static extern ResultCode ISampler_Init(nint self, in Desc desc);
+
+    [DllImport("UnCompute")]
+    private static extern void ISampler_GetDesc(nint self, out Desc desc);
+
+    /// <summary>
+    ///     Texel filtering mode used when a sampled image is read with a sampler.
+    /// </summary>
+    public enum Filter
+    {
+        /// <summary>
+        ///     Use the nearest texel.
+        /// </summary>
+        Nearest,
+
+        /// <summary>
+        ///     Linearly interpolate between the neighbouring texels.
+        /// </summary>
+        Linear
+    }
+
+    /// <summary>
+    ///     Sampler behaviour for coordinates outside of the image.
+    /// </summary>
+    public enum AddressMode
+    {
+        /// <summary>
+        ///     Wrap the coordinates around the image.
+        /// </summary>
+        Repeat,
+
+        /// <summary>
+        ///     Wrap the coordinates around the image and mirror every other repetition.
+        /// </summary>
+        MirroredRepeat,
+
+        /// <summary>
+        ///     Clamp the coordinates to the edge texels.
+        /// </summary>
+        ClampToEdge,
+
+        /// <summary>
+        ///     Return transparent black for coordinates outside of the image.
+        /// </summary>
+        ClampToBorder
+    }
+
+    /// <summary>
+    ///     Sampler descriptor.
+    /// </summary>
+    /// <param name="Name">Debug name of the object.</param>
+    /// <param name="FilterMode">Texel filtering mode.</param>
+    /// <param name="Addressing">Addressing mode for all dimensions.</param>
+    /// <param name="NormalizedCoordinates">
+    ///     True if the coordinates are in range [0, 1], false for texel coordinates.
+    ///     Texel coordinates can only be used with <see cref="AddressMode.ClampToEdge" /> and
+    ///     <see cref="AddressMode.ClampToBorder" />.
+    /// </param>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly record struct Desc(NativeString Name, Filter FilterMode = Filter.Linear,
+        AddressMode Addressing = AddressMode.ClampToEdge,
+        [field: MarshalAs(UnmanagedType.U1)] bool NormalizedCoordinates = true) : IDeviceObjectDescriptor;
+}
@@ -0,0 +1,45 @@
+﻿using System.Runtime.InteropServices;
+
+namespace UraniumCompute.Backend;
+
+/// <summary>
+///     Number of kernel invocations in a workgroup, declared with <c>[numthreads(X, Y, Z)]</c> in HLSL.
+/// </summary>
+/// <param name="X">Number of invocations along the X axis.</param>
+/// <param name="Y">Number of invocations along the Y axis.</param>
+/// <param name="Z">Number of invocations along the Z axis.</param>
+[StructLayout(LayoutKind.Sequential)]
+public readonly record struct WorkgroupSize(uint X, uint Y, uint Z)
+{
+    /// <summary>
+    ///     Total number of invocations in a workgroup.
+    /// </summary>
+    public uint InvocationCount => X * Y * Z;
+
+    /// <summary>
+    ///     Get the number of workgroups to dispatch along the X axis to run at least <paramref name="invocationCount" />
+    ///     invocations.
+    /// </summary>
+    public ulong GetGroupCountX(ulong invocationCount)
+    {
+        return (invocationCount + X - 1) / X;
+    }
+
+    /// <summary>
+    ///     Get the number of workgroups to dispatch along the Y axis to run at least <paramref name="invocationCount" />
+    ///     invocations.
+    /// </summary>
+    public ulong GetGroupCountY(ulong invocationCount)
+    {
+        return (invocationCount + Y - 1) / Y;
+    }
+
+    /// <summary>
+    ///     Get the number of workgroups to dispatch along the Z axis to run at least <paramref name="invocationCount" />
+    ///     invocations.
+    /// </summary>
+    public ulong GetGroupCountZ(ulong invocationCount)
+    {
+        return (invocationCount + Z - 1) / Z;
+    }
+}
@@ -1,6 +1,7 @@
 ﻿using System.Runtime.InteropServices;
 using System.Text;
 using UraniumCompute.Acceleration;
+using UraniumCompute.Backend;
 using UraniumCompute.Containers;
 using UraniumCompute.Memory;
 
@@ -29,6 +30,32 @@ public sealed class KernelCompiler : NativeObject
         IKernelCompiler_Init(Handle, in desc).ThrowOnError("Couldn't initialize kernel compiler");
     }
 
+    /// <summary>
+    ///     Register a header that kernels can include with <c>#include "name"</c>.
+    ///     The header is kept in native memory and reused by all the following compilations.
+    /// </summary>
+    /// <param name="name">The name used in <c>#include</c> directives.</param>
+    /// <param name="sourceCode">The source code of the header.</param>
+    public unsafe void RegisterInclude(string name, string sourceCode)
+    {
+        var unicodeSource = Encoding.UTF8.GetBytes(sourceCode);
+        fixed (byte* source = unicodeSource)
+        {
+            IKernelCompiler_RegisterInclude(Handle, name, source, (ulong)unicodeSource.Length)
+                .ThrowOnError($"Couldn't register kernel include {name}");
+        }
+    }
+
+    /// <summary>
+    ///     Read a header from disk once and register it, see <see cref="RegisterInclude" />.
+    /// </summary>
+    /// <param name="name">The name used in <c>#include</c> directives.</param>
+    /// <param name="path">Path to the header file.</param>
+    public void RegisterIncludeFile(string name, string path)
+    {
+        IKernelCompiler_RegisterIncludeFile(Handle, name, path).ThrowOnError($"Couldn't register kernel include {name}");
+    }
+
     /// <summary>
     ///     Compile a compute kernel into target language.
     /// </summary>
@@ -57,22 +84,140 @@ public sealed class KernelCompiler : NativeObject
                 {
                     pBegin = (sbyte*)defines,
                     pEnd = (sbyte*)(defines + nativeDefines.Length)
-                });
+                }, args.Features, args.OptimizerFlags);
             IKernelCompiler_Compile(Handle, in argsNative, ref bytecode).ThrowOnError("Couldn't compile kernel code");
         }
 
         return new NativeArray<byte>(in bytecode);
     }
 
+    /// <summary>
+    ///     Compile multiple compute kernels concurrently on a pool of worker threads.
+    ///     A failed compilation doesn't stop the others, its error is reported in the corresponding result.
+    /// </summary>
+    /// <param name="args">Compiler arguments of every kernel.</param>
+    /// <returns>Compiled byte-code and result code of every kernel, in the same order as <see cref="args" />.</returns>
+    public unsafe BatchResult[] CompileBatch(IReadOnlyList<Args> args)
+    {
+        var handles = new List<GCHandle>();
+        var argsNative = new ArgsNative[args.Count];
+        var bytecode = new NativeArrayBase[args.Count];
+        var resultCodes = new ResultCode[args.Count];
+        var errorMessages = new NativeArrayBase[args.Count];
+
+        try
+        {
+            for (var i = 0; i < args.Count; ++i)
+            {
+                var nativeDefines = (args[i].Definitions ?? ArraySegment<Define>.Empty)
+                    .Select(x => new DefineNative(x.Name, x.Value))
+                    .ToArray();
+                var unicodeSource = Encoding.UTF8.GetBytes(args[i].SourceCode);
+
+                var sourceHandle = GCHandle.Alloc(unicodeSource, GCHandleType.Pinned);
+                handles.Add(sourceHandle);
+                var definesHandle = GCHandle.Alloc(nativeDefines, GCHandleType.Pinned);
+                handles.Add(definesHandle);
+
+                var source = (sbyte*)sourceHandle.AddrOfPinnedObject();
+                var defines = (DefineNative*)definesHandle.AddrOfPinnedObject();
+                argsNative[i] = new ArgsNative(
+                    new ArraySliceBase
+                    {
+                        pBegin = source,
+                        pEnd = source + unicodeSource.Length
+                    }, args[i].OptimizationLevel, args[i].EntryPoint,
+                    new ArraySliceBase
+                    {
+                        pBegin = (sbyte*)defines,
+                        pEnd = (sbyte*)(defines + nativeDefines.Length)
+                    }, args[i].Features, args[i].OptimizerFlags);
+            }
+
+            fixed (ArgsNative* pArgs = argsNative)
+            fixed (NativeArrayBase* pBytecode = bytecode)
+            fixed (ResultCode* pResultCodes = resultCodes)
+            fixed (NativeArrayBase* pErrorMessages = errorMessages)
+            {
+                IKernelCompiler_CompileBatch(Handle, pArgs, (uint)argsNative.Length, pBytecode, pResultCodes,
+                    pErrorMessages);
+            }
+        }
+        finally
+        {
+            foreach (var handle in handles)
+            {
+                handle.Free();
+            }
+        }
+
+        var results = new BatchResult[args.Count];
+        for (var i = 0; i < results.Length; ++i)
+        {
+            using var errorMessage = new NativeArray<byte>(in errorMessages[i]);
+            results[i] = new BatchResult(new NativeArray<byte>(in bytecode[i]), resultCodes[i],
+                Encoding.UTF8.GetString(errorMessage[..]));
+        }
+
+        return results;
+    }
+
+    /// <summary>
+    ///     Get reflection data of a compiled kernel.
+    /// </summary>
+    /// <param name="bytecode">Kernel bytecode returned by <see cref="Compile" />.</param>
+    /// <param name="entryPoint">Name of the kernel entry point, null to use the first one.</param>
+    /// <returns>Workgroup size, resource layout and push constant ranges of the kernel.</returns>
+    public unsafe Reflection Reflect(ReadOnlySpan<byte> bytecode, NativeString entryPoint = default)
+    {
+        // We do not use 'out' here to avoid C++ code trying to deallocate uninitialized pointers.
+        var reflection = new ReflectionNative();
+        fixed (byte* p = bytecode)
+        {
+            IKernelCompiler_Reflect(Handle, p, (ulong)bytecode.Length, entryPoint, ref reflection)
+                .ThrowOnError("Couldn't reflect kernel bytecode");
+        }
+
+        using var resourceLayout = new NativeArray<KernelResourceDesc>(in reflection.ResourceLayout);
+        using var resourceSizes = new NativeArray<uint>(in reflection.ResourceSizes);
+        using var pushConstantRanges = new NativeArray<PushConstantRange>(in reflection.PushConstantRanges);
+        return new Reflection(reflection.LocalSize, resourceLayout.ToArray(), resourceSizes.ToArray(),
+            pushConstantRanges.ToArray());
+    }
+
     [DllImport("UnCompute")]
     private static extern ResultCode IKernelCompiler_Init(nint self, in Desc desc);
 
     [DllImport("UnCompute")]
     private static extern void IKernelCompiler_GetDesc(nint self, out Desc desc);
 
+    [DllImport("UnCompute")]
+    private static extern unsafe ResultCode IKernelCompiler_RegisterInclude(nint self, NativeString name, byte* source,
+        ulong sourceSize);
+
+    [DllImport("UnCompute")]
+    private static extern ResultCode IKernelCompiler_RegisterIncludeFile(nint self, NativeString name, NativeString path);
+
     [DllImport("UnCompute")]
     private static extern ResultCode IKernelCompiler_Compile(nint self, in ArgsNative args, ref NativeArrayBase bytecode);
 
+    [DllImport("UnCompute")]
+    private static extern unsafe ResultCode IKernelCompiler_CompileBatch(nint self, ArgsNative* args, uint argCount,
+        NativeArrayBase* bytecode, ResultCode* resultCodes, NativeArrayBase* errorMessages);
+
+    [DllImport("UnCompute")]
+    private static extern unsafe ResultCode IKernelCompiler_Reflect(nint self, byte* bytecode, ulong bytecodeSize,
+        NativeString entryPoint, ref ReflectionNative reflection);
+
+    [StructLayout(LayoutKind.Sequential)]
+    private struct ReflectionNative
+    {
+        public WorkgroupSize LocalSize;
+        public NativeArrayBase ResourceLayout;
+        public NativeArrayBase ResourceSizes;
+        public NativeArrayBase PushConstantRanges;
+    }
+
     [StructLayout(LayoutKind.Sequential, CharSet = CharSet.Ansi)]
     private readonly record struct DefineNative(NativeString Name, NativeString Value);
 
@@ -89,13 +234,39 @@ public sealed class KernelCompiler : NativeObject
     /// <param name="Name">Compiler debug name.</param>
     /// <param name="SourceLang">Source code language.</param>
     /// <param name="TargetLang">Target code language.</param>
+    /// <param name="CacheDirectory">
+    ///     Directory of the persistent compilation cache, null to keep compiled kernels in memory only.
+    /// </param>
+    /// <param name="MemoryCacheCapacity">
+    ///     Maximum number of compiled kernels kept in memory, zero disables the cache if no directory is set.
+    /// </param>
+    /// <param name="TargetEnv">
+    ///     Environment the kernels run in, must not be newer than <see cref="AdapterInfo.TargetEnv" /> of the device's adapter.
+    /// </param>
+    /// <param name="ShaderModel">
+    ///     Minimum shader model of the kernels, must not be newer than <see cref="AdapterInfo.ShaderModel" />.
+    ///     The compiler raises it if a kernel uses features that require a newer one.
+    /// </param>
     [StructLayout(LayoutKind.Sequential)]
     public readonly record struct Desc(NativeString Name, KernelSourceLang SourceLang = KernelSourceLang.Hlsl,
-        KernelTargetLang TargetLang = KernelTargetLang.SpirV);
+        KernelTargetLang TargetLang = KernelTargetLang.SpirV, NativeString CacheDirectory = default,
+        uint MemoryCacheCapacity = 64, KernelTargetEnv TargetEnv = KernelTargetEnv.Vulkan1_1,
+        KernelShaderModel ShaderModel = KernelShaderModel.SM6_0)
+    {
+        /// <summary>
+        ///     Target the newest environment and shader model supported by an adapter.
+        /// </summary>
+        /// <param name="adapter">The adapter of the device the compiled kernels will run on.</param>
+        /// <returns>A copy of the descriptor with updated target.</returns>
+        public Desc WithTarget(in AdapterInfo adapter)
+        {
+            return this with { TargetEnv = adapter.TargetEnv, ShaderModel = adapter.ShaderModel };
+        }
+    }
 
     [StructLayout(LayoutKind.Sequential)]
     private readonly record struct ArgsNative(ArraySliceBase SourceCode, CompilerOptimizationLevel OptimizationLevel,
-        NativeString EntryPoint, ArraySliceBase Definitions);
+        NativeString EntryPoint, ArraySliceBase Definitions, DeviceFeatureFlags Features, SpirVOptimizerFlags OptimizerFlags);
 
     /// <summary>
     ///     Kernel compiler arguments that define a single compilation.
@@ -104,6 +275,36 @@ public sealed class KernelCompiler : NativeObject
     /// <param name="OptimizationLevel">Compiler optimization level.</param>
     /// <param name="EntryPoint">Compute shader entry point.</param>
     /// <param name="Definitions">Compiler definitions.</param>
+    /// <param name="Features">
+    ///     Optional device features used by the kernel, 16-bit features enable native 16-bit types.
+    ///     The device must be created with the same features.
+    /// </param>
+    /// <param name="OptimizerFlags">Additional SPIR-V optimizer passes, e.g. to make the module smaller.</param>
     public readonly record struct Args(string SourceCode, CompilerOptimizationLevel OptimizationLevel,
-        NativeString EntryPoint, IEnumerable<Define>? Definitions = null);
+        NativeString EntryPoint, IEnumerable<Define>? Definitions = null, DeviceFeatureFlags Features = DeviceFeatureFlags.None,
+        SpirVOptimizerFlags OptimizerFlags = SpirVOptimizerFlags.None);
+
+    /// <summary>
+    ///     Result of a single compilation in <see cref="CompileBatch" />.
+    /// </summary>
+    /// <param name="Bytecode">Compiled byte-code, empty if the compilation failed.</param>
+    /// <param name="Result">Result code of the compilation.</param>
+    /// <param name="ErrorMessage">Compiler output if the compilation failed, empty otherwise.</param>
+    public readonly record struct BatchResult(NativeArray<byte> Bytecode, ResultCode Result, string ErrorMessage);
+
+    /// <summary>
+    ///     Reflection data of a compiled kernel.
+    /// </summary>
+    /// <param name="LocalSize">Workgroup size declared in the kernel.</param>
+    /// <param name="ResourceLayout">
+    ///     Resources used by the kernel sorted by binding index, can be used as <see cref="ResourceBinding.Desc.Layout" />.
+    ///     The format of typed buffers is derived from the element type declared in the kernel.
+    /// </param>
+    /// <param name="ResourceSizes">
+    ///     Size of a constant buffer or stride of a structured buffer in bytes for every resource in
+    ///     <paramref name="ResourceLayout" />, zero for other resources.
+    /// </param>
+    /// <param name="PushConstantRanges">Push constant ranges used by the kernel.</param>
+    public sealed record Reflection(WorkgroupSize LocalSize, KernelResourceDesc[] ResourceLayout, uint[] ResourceSizes,
+        PushConstantRange[] PushConstantRanges);
 }
@@ -0,0 +1,42 @@
+﻿namespace UraniumCompute.Compilation;
+
+/// <summary>
+///     HLSL shader model that compiled kernels use, defines the available intrinsics.
+/// </summary>
+public enum KernelShaderModel
+{
+    /// <summary>
+    ///     Wave intrinsics.
+    /// </summary>
+    SM6_0,
+
+    /// <summary>
+    ///     SV_ViewID and barycentrics, no new compute intrinsics.
+    /// </summary>
+    SM6_1,
+
+    /// <summary>
+    ///     Native 16-bit types.
+    /// </summary>
+    SM6_2,
+
+    /// <summary>
+    ///     Ray tracing, no new compute intrinsics.
+    /// </summary>
+    SM6_3,
+
+    /// <summary>
+    ///     Packed 8-bit dot products (dot4add_u8packed, etc.).
+    /// </summary>
+    SM6_4,
+
+    /// <summary>
+    ///     WaveMatch and WaveMultiPrefix intrinsics.
+    /// </summary>
+    SM6_5,
+
+    /// <summary>
+    ///     64-bit atomics, packed 8-bit types and WaveSize attribute.
+    /// </summary>
+    SM6_6
+}
@@ -0,0 +1,23 @@
+﻿namespace UraniumCompute.Compilation;
+
+/// <summary>
+///     Environment that compiled kernels target, defines the SPIR-V version and the core capabilities available.
+///     The newest environment supported by an adapter is reported in <see cref="Acceleration.AdapterInfo.TargetEnv" />.
+/// </summary>
+public enum KernelTargetEnv
+{
+    /// <summary>
+    ///     Vulkan 1.1, SPIR-V 1.3.
+    /// </summary>
+    Vulkan1_1,
+
+    /// <summary>
+    ///     Vulkan 1.2, SPIR-V 1.5.
+    /// </summary>
+    Vulkan1_2,
+
+    /// <summary>
+    ///     Vulkan 1.3, SPIR-V 1.6.
+    /// </summary>
+    Vulkan1_3
+}
@@ -0,0 +1,11 @@
+﻿using System.Runtime.InteropServices;
+
+namespace UraniumCompute.Compilation;
+
+/// <summary>
+///     A range of push constants used by a kernel.
+/// </summary>
+/// <param name="Offset">Offset of the first push constant in bytes.</param>
+/// <param name="Size">Size of the range in bytes.</param>
+[StructLayout(LayoutKind.Sequential)]
+public readonly record struct PushConstantRange(uint Offset, uint Size);
@@ -0,0 +1,31 @@
+﻿namespace UraniumCompute.Compilation;
+
+/// <summary>
+///     Flags that enable additional SPIR-V optimizer passes, ignored for other target languages.
+///     The passes run after the optimization passes selected by <see cref="CompilerOptimizationLevel" />.
+///     The flags are ignored with <see cref="CompilerOptimizationLevel.None" />, since the SPIR-V optimizer doesn't run
+///     at all in this case.
+/// </summary>
+[Flags]
+public enum SpirVOptimizerFlags
+{
+    /// <summary>
+    ///     Only run the passes selected by the optimization level.
+    /// </summary>
+    None = 0,
+
+    /// <summary>
+    ///     Run the size reduction recipe instead of the performance one.
+    /// </summary>
+    OptimizeSize = 1 << 0,
+
+    /// <summary>
+    ///     Remove debug names, source information and non-semantic decorations.
+    /// </summary>
+    StripDebugInfo = 1 << 1,
+
+    /// <summary>
+    ///     Renumber the result IDs densely, so that the module compresses better.
+    /// </summary>
+    CompactIds = 1 << 2
+}
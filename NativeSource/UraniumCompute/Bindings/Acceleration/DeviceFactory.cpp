@@ -17,6 +17,12 @@ namespace UN
             adapters.CopyDataTo(*pAdapters);
         }
 
+        UN_DLL_EXPORT ResultCode IDeviceFactory_GetAdapterCapabilities(IDeviceFactory* self, UInt32 adapterId,
+                                                                       AdapterCapabilities* pCapabilities)
+        {
+            return self->GetAdapterCapabilities(adapterId, pCapabilities);
+        }
+
         UN_DLL_EXPORT ResultCode IDeviceFactory_CreateDevice(IDeviceFactory* self, IComputeDevice** ppDevice)
         {
             return self->CreateDevice(ppDevice);
@@ -40,6 +40,17 @@ namespace UN
             return self->Submit();
         }
 
+        UN_DLL_EXPORT ResultCode ICommandList_SubmitWithCallback(ICommandList* self, CommandListCompletionCallback callback,
+                                                                 void* pUserData)
+        {
+            return self->Submit(callback, pUserData);
+        }
+
+        UN_DLL_EXPORT ResultCode ICommandList_GetTimestamps(ICommandList* self, UInt64* pTimestamps, UInt64 count)
+        {
+            return self->GetTimestamps(ArraySlice<UInt64>(pTimestamps, count));
+        }
+
         UN_DLL_EXPORT void CommandListBuilder_End(CommandListBuilder* self)
         {
             self->End();
@@ -51,15 +62,62 @@ namespace UN
             self->MemoryBarrier(pBuffer, barrierDesc);
         }
 
+        UN_DLL_EXPORT void CommandListBuilder_ImageMemoryBarrier(CommandListBuilder* self, IImage* pImage,
+                                                                 const MemoryBarrierDesc& barrierDesc)
+        {
+            self->MemoryBarrier(pImage, barrierDesc);
+        }
+
         UN_DLL_EXPORT void CommandListBuilder_Copy(CommandListBuilder* self, IBuffer* pSource, IBuffer* pDestination,
                                                    const BufferCopyRegion& region)
         {
             self->Copy(pSource, pDestination, region);
         }
 
+        UN_DLL_EXPORT void CommandListBuilder_CopyRegions(CommandListBuilder* self, IBuffer* pSource, IBuffer* pDestination,
+                                                          const BufferCopyRegion* pRegions, UInt64 regionCount)
+        {
+            self->Copy(pSource, pDestination, ArraySlice<const BufferCopyRegion>(pRegions, regionCount));
+        }
+
+        UN_DLL_EXPORT void CommandListBuilder_CopyBufferToImage(CommandListBuilder* self, IBuffer* pSource, IImage* pDestination,
+                                                                const BufferImageCopyRegion& region)
+        {
+            self->Copy(pSource, pDestination, region);
+        }
+
+        UN_DLL_EXPORT void CommandListBuilder_CopyImageToBuffer(CommandListBuilder* self, IImage* pSource, IBuffer* pDestination,
+                                                                const BufferImageCopyRegion& region)
+        {
+            self->Copy(pSource, pDestination, region);
+        }
+
+        UN_DLL_EXPORT void CommandListBuilder_Fill(CommandListBuilder* self, IBuffer* pBuffer, UInt64 offset, UInt64 size,
+                                                   UInt32 value)
+        {
+            self->Fill(pBuffer, offset, size, value);
+        }
+
+        UN_DLL_EXPORT void CommandListBuilder_Update(CommandListBuilder* self, IBuffer* pBuffer, UInt64 offset, const void* pData,
+                                                     UInt64 size)
+        {
+            self->Update(pBuffer, offset, pData, size);
+        }
+
         UN_DLL_EXPORT void CommandListBuilder_Dispatch(CommandListBuilder* self, IKernel* pKernel, Int32 x, Int32 y, Int32 z)
         {
             self->Dispatch(pKernel, x, y, z);
         }
+
+        UN_DLL_EXPORT void CommandListBuilder_DispatchIndirect(CommandListBuilder* self, IKernel* pKernel, IBuffer* pArgsBuffer,
+                                                               UInt64 offset)
+        {
+            self->DispatchIndirect(pKernel, pArgsBuffer, offset);
+        }
+
+        UN_DLL_EXPORT void CommandListBuilder_WriteTimestamp(CommandListBuilder* self, UInt32 index)
+        {
+            self->WriteTimestamp(index);
+        }
     }
 } // namespace UN
@@ -9,11 +9,31 @@ namespace UN
             return self->Init(desc);
         }
 
+        UN_DLL_EXPORT ResultCode IComputeDevice_GetMemoryBudget(IComputeDevice* self, MemoryBudget* pBudget)
+        {
+            return self->GetMemoryBudget(pBudget);
+        }
+
+        UN_DLL_EXPORT void IComputeDevice_GetAdapterInfo(IComputeDevice* self, AdapterInfo* pInfo)
+        {
+            *pInfo = self->GetAdapterInfo();
+        }
+
         UN_DLL_EXPORT ResultCode IComputeDevice_CreateBuffer(IComputeDevice* self, IBuffer** ppBuffer)
         {
             return self->CreateBuffer(ppBuffer);
         }
 
+        UN_DLL_EXPORT ResultCode IComputeDevice_CreateImage(IComputeDevice* self, IImage** ppImage)
+        {
+            return self->CreateImage(ppImage);
+        }
+
+        UN_DLL_EXPORT ResultCode IComputeDevice_CreateSampler(IComputeDevice* self, ISampler** ppSampler)
+        {
+            return self->CreateSampler(ppSampler);
+        }
+
         UN_DLL_EXPORT ResultCode IComputeDevice_CreateMemory(IComputeDevice* self, IDeviceMemory** ppMemory)
         {
             return self->CreateMemory(ppMemory);
@@ -38,5 +38,10 @@ namespace UN
         {
             return self->GetState();
         }
+
+        UN_DLL_EXPORT ResultCode IFence_ExportCompletionFd(IFence* self, Int32* pFileDescriptor)
+        {
+            return self->ExportCompletionFd(pFileDescriptor);
+        }
     }
 } // namespace UN
@@ -0,0 +1,23 @@
+#include <UnCompute/Backend/IDeviceMemory.h>
+#include <UnCompute/Backend/IImage.h>
+
+namespace UN
+{
+    extern "C"
+    {
+        UN_DLL_EXPORT ResultCode IImage_Init(IImage* self, const ImageDesc& desc)
+        {
+            return self->Init(desc);
+        }
+
+        UN_DLL_EXPORT void IImage_GetDesc(IImage* self, ImageDesc& desc)
+        {
+            desc = self->GetDesc();
+        }
+
+        UN_DLL_EXPORT ResultCode IImage_BindMemory(IImage* self, const DeviceMemorySlice& slice)
+        {
+            return self->BindMemory(slice);
+        }
+    }
+} // namespace UN
@@ -13,5 +13,10 @@ namespace UN
         {
             desc = self->GetDesc();
         }
+
+        UN_DLL_EXPORT void IKernel_GetWorkgroupSize(IKernel* self, WorkgroupSize* pSize)
+        {
+            *pSize = self->GetWorkgroupSize();
+        }
     }
 } // namespace UN
@@ -18,5 +18,15 @@ namespace UN
         {
             return self->SetVariable(bindingIndex, pBuffer);
         }
+
+        UN_DLL_EXPORT ResultCode IResourceBinding_SetImage(IResourceBinding* self, Int32 bindingIndex, IImage* pImage)
+        {
+            return self->SetVariable(bindingIndex, pImage);
+        }
+
+        UN_DLL_EXPORT ResultCode IResourceBinding_SetSampler(IResourceBinding* self, Int32 bindingIndex, ISampler* pSampler)
+        {
+            return self->SetVariable(bindingIndex, pSampler);
+        }
     }
 } // namespace UN
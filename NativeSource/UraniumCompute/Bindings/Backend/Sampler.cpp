@@ -0,0 +1,17 @@
+#include <UnCompute/Backend/ISampler.h>
+
+namespace UN
+{
+    extern "C"
+    {
+        UN_DLL_EXPORT ResultCode ISampler_Init(ISampler* self, const SamplerDesc& desc)
+        {
+            return self->Init(desc);
+        }
+
+        UN_DLL_EXPORT void ISampler_GetDesc(ISampler* self, SamplerDesc& desc)
+        {
+            desc = self->GetDesc();
+        }
+    }
+} // namespace UN
@@ -14,10 +14,34 @@ namespace UN
             desc = self->GetDesc();
         }
 
+        UN_DLL_EXPORT ResultCode IKernelCompiler_RegisterInclude(IKernelCompiler* self, const char* name, const Byte* pSource,
+                                                                 UInt64 sourceSize)
+        {
+            return self->RegisterInclude(name, ArraySlice(pSource, sourceSize));
+        }
+
+        UN_DLL_EXPORT ResultCode IKernelCompiler_RegisterIncludeFile(IKernelCompiler* self, const char* name, const char* path)
+        {
+            return self->RegisterIncludeFile(name, path);
+        }
+
         UN_DLL_EXPORT ResultCode IKernelCompiler_Compile(IKernelCompiler* self, const KernelCompilerArgs& args,
                                                          HeapArray<Byte>* pResult)
         {
             return self->Compile(args, pResult);
         }
+
+        UN_DLL_EXPORT ResultCode IKernelCompiler_CompileBatch(IKernelCompiler* self, const KernelCompilerArgs* pArgs,
+                                                              UInt32 argCount, HeapArray<Byte>* pResults,
+                                                              ResultCode* pResultCodes, HeapArray<Byte>* pErrorMessages)
+        {
+            return self->CompileBatch(ArraySlice(pArgs, argCount), pResults, pResultCodes, pErrorMessages);
+        }
+
+        UN_DLL_EXPORT ResultCode IKernelCompiler_Reflect(IKernelCompiler* self, const Byte* pBytecode, UInt64 bytecodeSize,
+                                                         const char* entryPoint, KernelReflection* pReflection)
+        {
+            return self->Reflect(ArraySlice(pBytecode, bytecodeSize), entryPoint, pReflection);
+        }
     }
 } // namespace UN
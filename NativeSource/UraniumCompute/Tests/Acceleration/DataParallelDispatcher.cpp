@@ -0,0 +1,50 @@
+#include <Tests/Common/Common.h>
+#include <UnCompute/Acceleration/DataParallelDispatcher.h>
+#include <numeric>
+
+using namespace UN;
+
+TEST(DataParallelDispatcher, SplitWorkgroupsEvenly)
+{
+    std::vector<Float64> weights = { 0, 0, 0 };
+    std::vector<UInt64> result(3);
+    DataParallelDispatcher::SplitWorkgroups(10, weights, result);
+
+    EXPECT_EQ(std::accumulate(result.begin(), result.end(), UInt64{ 0 }), 10);
+    for (auto count : result)
+    {
+        EXPECT_GE(count, 3);
+        EXPECT_LE(count, 4);
+    }
+}
+
+TEST(DataParallelDispatcher, SplitWorkgroupsProportionally)
+{
+    std::vector<Float64> weights = { 3000.0, 1000.0 };
+    std::vector<UInt64> result(2);
+    DataParallelDispatcher::SplitWorkgroups(100, weights, result);
+
+    EXPECT_EQ(result[0], 75);
+    EXPECT_EQ(result[1], 25);
+}
+
+TEST(DataParallelDispatcher, SplitWorkgroupsKeepsTotal)
+{
+    std::vector<Float64> weights = { 1.0, 1.0, 1.0, 0.5 };
+    std::vector<UInt64> result(4);
+    for (UInt64 workgroupCount = 0; workgroupCount < 50; ++workgroupCount)
+    {
+        DataParallelDispatcher::SplitWorkgroups(workgroupCount, weights, result);
+        EXPECT_EQ(std::accumulate(result.begin(), result.end(), UInt64{ 0 }), workgroupCount);
+    }
+}
+
+TEST(DataParallelDispatcher, SplitWorkgroupsSkipsZeroWeights)
+{
+    std::vector<Float64> weights = { 0.0, 2.0 };
+    std::vector<UInt64> result(2);
+    DataParallelDispatcher::SplitWorkgroups(7, weights, result);
+
+    EXPECT_EQ(result[0], 0);
+    EXPECT_EQ(result[1], 7);
+}
@@ -0,0 +1,65 @@
+#include <Tests/Common/Common.h>
+#include <UnCompute/Acceleration/KernelAutotuner.h>
+#include <string_view>
+
+using namespace UN;
+
+namespace
+{
+    constexpr std::string_view Source = "[numthreads(WORKGROUP_SIZE_X, WORKGROUP_SIZE_Y, WORKGROUP_SIZE_Z)] void main() {}";
+
+    const WorkgroupSize Candidates[] = { WorkgroupSize(64, 1, 1), WorkgroupSize(128, 1, 1), WorkgroupSize(256, 1, 1) };
+
+    KernelAutotunerArgs MakeArgs()
+    {
+        KernelAutotunerArgs args;
+        args.CompilerArgs.SourceCode = ArraySlice(reinterpret_cast<const Byte*>(Source.data()), Source.size());
+        args.Candidates              = Candidates;
+        args.InvocationCountX        = 1024 * 1024;
+        return args;
+    }
+} // namespace
+
+TEST(KernelAutotuner, KeyDependsOnInputs)
+{
+    KernelCompilerDesc desc("Test compiler");
+    AdapterInfo adapter{};
+    auto args = MakeArgs();
+    auto key  = KernelAutotuner::ComputeKey(desc, args, adapter);
+
+    EXPECT_EQ(key.size(), 64);
+    EXPECT_EQ(key, KernelAutotuner::ComputeKey(desc, args, adapter));
+
+    auto otherAdapter          = adapter;
+    otherAdapter.DeviceUuid[0] = 1;
+    EXPECT_NE(key, KernelAutotuner::ComputeKey(desc, args, otherAdapter));
+
+    auto renamedAdapter    = adapter;
+    renamedAdapter.Name[0] = 'X';
+    EXPECT_EQ(key, KernelAutotuner::ComputeKey(desc, args, renamedAdapter));
+
+    auto fewerCandidates       = args;
+    fewerCandidates.Candidates = ArraySlice(Candidates, 2);
+    EXPECT_NE(key, KernelAutotuner::ComputeKey(desc, fewerCandidates, adapter));
+
+    auto largerDispatch             = args;
+    largerDispatch.InvocationCountX = 2048 * 1024;
+    EXPECT_NE(key, KernelAutotuner::ComputeKey(desc, largerDispatch, adapter));
+
+    auto otherTarget        = desc;
+    otherTarget.TargetEnv   = KernelTargetEnv::Vulkan1_3;
+    otherTarget.ShaderModel = KernelShaderModel::SM6_6;
+    EXPECT_NE(key, KernelAutotuner::ComputeKey(otherTarget, args, adapter));
+}
+
+TEST(KernelAutotuner, TimingIterationsDoNotChangeKey)
+{
+    KernelCompilerDesc desc("Test compiler");
+    AdapterInfo adapter{};
+    auto args = MakeArgs();
+
+    auto moreIterations             = args;
+    moreIterations.WarmupIterations = 5;
+    moreIterations.TimedIterations  = 100;
+    EXPECT_EQ(KernelAutotuner::ComputeKey(desc, args, adapter), KernelAutotuner::ComputeKey(desc, moreIterations, adapter));
+}
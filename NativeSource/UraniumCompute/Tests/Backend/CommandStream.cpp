@@ -0,0 +1,157 @@
+#include <Tests/Common/Common.h>
+#include <UnCompute/Backend/CommandStream.h>
+#include <cstring>
+
+using namespace UN;
+
+namespace
+{
+    // The stream never dereferences the resources, so fake pointers are enough to check the recorded commands.
+    template<class T>
+    T* FakeResource(USize id)
+    {
+        return reinterpret_cast<T*>(id * 16);
+    }
+} // namespace
+
+TEST(CommandStream, Empty)
+{
+    CommandStream stream;
+    EXPECT_EQ(stream.GetCommandCount(), 0);
+    EXPECT_EQ(stream.begin(), stream.end());
+}
+
+TEST(CommandStream, RecordsInOrder)
+{
+    CommandStream stream;
+    BufferCopyRegion regions[] = { BufferCopyRegion(0, 16, 32), BufferCopyRegion(64, 0, 8) };
+    stream.Copy(FakeResource<IBuffer>(1), FakeResource<IBuffer>(2), regions);
+    stream.Dispatch(FakeResource<IKernel>(3), 4, 5, 6);
+    stream.Fill(FakeResource<IBuffer>(2), 8, 24, 0xFF);
+
+    ASSERT_EQ(stream.GetCommandCount(), 3);
+    auto iter = stream.begin();
+
+    ASSERT_EQ(iter->Type, CommandType::CopyBuffer);
+    auto& copy = iter->Get<CopyBufferCommand>();
+    EXPECT_EQ(copy.pSource, FakeResource<IBuffer>(1));
+    EXPECT_EQ(copy.pDestination, FakeResource<IBuffer>(2));
+    ASSERT_EQ(copy.GetRegions().Length(), 2);
+    EXPECT_EQ(copy.GetRegions()[1].SourceOffset, 64);
+    EXPECT_EQ(copy.GetRegions()[1].Size, 8);
+
+    ++iter;
+    ASSERT_EQ(iter->Type, CommandType::Dispatch);
+    auto& dispatch = iter->Get<DispatchCommand>();
+    EXPECT_EQ(dispatch.pKernel, FakeResource<IKernel>(3));
+    EXPECT_EQ(dispatch.X, 4);
+    EXPECT_EQ(dispatch.Y, 5);
+    EXPECT_EQ(dispatch.Z, 6);
+
+    ++iter;
+    ASSERT_EQ(iter->Type, CommandType::Fill);
+    EXPECT_EQ(iter->Get<FillCommand>().Value, 0xFF);
+
+    ++iter;
+    EXPECT_EQ(iter, stream.end());
+}
+
+TEST(CommandStream, CopiesUpdateData)
+{
+    CommandStream stream;
+    UInt32 data[] = { 1, 2, 3 };
+    stream.Update(FakeResource<IBuffer>(1), 4, data, sizeof(data));
+    data[0] = 100;
+    stream.Dispatch(FakeResource<IKernel>(2), 1, 1, 1);
+
+    auto iter    = stream.begin();
+    auto& update = iter->Get<UpdateCommand>();
+    ASSERT_EQ(update.Size, sizeof(data));
+
+    UInt32 recorded[3];
+    memcpy(recorded, update.GetData(), sizeof(recorded));
+    EXPECT_EQ(recorded[0], 1);
+    EXPECT_EQ(recorded[2], 3);
+
+    ++iter;
+    EXPECT_EQ(iter->Type, CommandType::Dispatch);
+}
+
+TEST(CommandStream, CoalescesConsecutiveBarriers)
+{
+    CommandStream stream;
+    stream.MemoryBarrier(FakeResource<IBuffer>(1), MemoryBarrierDesc(AccessFlags::TransferWrite, AccessFlags::KernelRead));
+    stream.MemoryBarrier(FakeResource<IBuffer>(2), MemoryBarrierDesc(AccessFlags::HostWrite, AccessFlags::TransferRead));
+    stream.MemoryBarrier(FakeResource<IImage>(3), MemoryBarrierDesc(AccessFlags::None, AccessFlags::KernelRead));
+    stream.MemoryBarrier(FakeResource<IBuffer>(1), MemoryBarrierDesc(AccessFlags::KernelWrite, AccessFlags::KernelWrite));
+    stream.Dispatch(FakeResource<IKernel>(4), 1, 1, 1);
+    stream.MemoryBarrier(FakeResource<IBuffer>(1), MemoryBarrierDesc(AccessFlags::KernelWrite, AccessFlags::TransferRead));
+
+    ASSERT_EQ(stream.GetCommandCount(), 3);
+    auto iter     = stream.begin();
+    auto barriers = iter->Get<MemoryBarrierCommand>().GetBarriers();
+    ASSERT_EQ(barriers.Length(), 3);
+
+    EXPECT_EQ(barriers[0].pBuffer, FakeResource<IBuffer>(1));
+    EXPECT_EQ(barriers[0].Desc.SourceAccess, AccessFlags::TransferWrite | AccessFlags::KernelWrite);
+    EXPECT_EQ(barriers[0].Desc.DestAccess, AccessFlags::KernelRead | AccessFlags::KernelWrite);
+    EXPECT_EQ(barriers[1].pBuffer, FakeResource<IBuffer>(2));
+    EXPECT_EQ(barriers[2].pBuffer, nullptr);
+    EXPECT_EQ(barriers[2].pImage, FakeResource<IImage>(3));
+
+    ++iter;
+    EXPECT_EQ(iter->Type, CommandType::Dispatch);
+    ++iter;
+    EXPECT_EQ(iter->Get<MemoryBarrierCommand>().GetBarriers().Length(), 1);
+}
+
+TEST(CommandStream, DoesNotMergeQueueTransfers)
+{
+    CommandStream stream;
+    stream.MemoryBarrier(FakeResource<IBuffer>(1), MemoryBarrierDesc(AccessFlags::TransferWrite, AccessFlags::KernelRead));
+    stream.MemoryBarrier(FakeResource<IBuffer>(1),
+                         MemoryBarrierDesc(AccessFlags::TransferWrite,
+                                           AccessFlags::KernelRead,
+                                           HardwareQueueKindFlags::Transfer,
+                                           HardwareQueueKindFlags::Compute));
+
+    ASSERT_EQ(stream.GetCommandCount(), 1);
+    EXPECT_EQ(stream.begin()->Get<MemoryBarrierCommand>().GetBarriers().Length(), 2);
+}
+
+TEST(CommandStream, ClearRemovesCommands)
+{
+    CommandStream stream;
+    stream.Dispatch(FakeResource<IKernel>(1), 1, 1, 1);
+    stream.Clear();
+    EXPECT_EQ(stream.GetCommandCount(), 0);
+    EXPECT_EQ(stream.GetByteSize(), 0);
+
+    stream.MemoryBarrier(FakeResource<IBuffer>(1), MemoryBarrierDesc(AccessFlags::TransferWrite, AccessFlags::KernelRead));
+    EXPECT_EQ(stream.begin()->Get<MemoryBarrierCommand>().GetBarriers().Length(), 1);
+}
+
+TEST(CommandStream, DetectsOversizeDispatches)
+{
+    const UInt32 maxGroupCount[] = { 65535, 4, 65535 };
+
+    DispatchCommand dispatch;
+    dispatch.X = 65535;
+    dispatch.Y = 4;
+    EXPECT_FALSE(dispatch.Exceeds(maxGroupCount));
+
+    dispatch.X = 65536;
+    EXPECT_TRUE(dispatch.Exceeds(maxGroupCount));
+
+    dispatch.X = 200000;
+    dispatch.Y = 6;
+    EXPECT_TRUE(dispatch.Exceeds(maxGroupCount));
+
+    dispatch.X = 1;
+    dispatch.Y = 5;
+    EXPECT_TRUE(dispatch.Exceeds(maxGroupCount));
+
+    dispatch.Y = 1;
+    dispatch.Z = 65536;
+    EXPECT_TRUE(dispatch.Exceeds(maxGroupCount));
+}
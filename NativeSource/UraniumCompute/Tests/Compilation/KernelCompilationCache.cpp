@@ -0,0 +1,175 @@
+#include <Tests/Common/Common.h>
+#include <UnCompute/Compilation/KernelCompilationCache.h>
+#include <UnCompute/Memory/Ptr.h>
+#include <algorithm>
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+using namespace UN;
+
+namespace
+{
+    KernelCompilerArgs MakeArgs(std::string_view source)
+    {
+        KernelCompilerArgs args;
+        args.SourceCode = ArraySlice(reinterpret_cast<const Byte*>(source.data()), source.size());
+        return args;
+    }
+
+    HeapArray<Byte> MakeBytecode(UInt8 value)
+    {
+        return HeapArray<Byte>(4, static_cast<Byte>(value));
+    }
+} // namespace
+
+TEST(KernelCompilationCache, KeyDependsOnInputs)
+{
+    KernelCompilerDesc desc("Test compiler");
+    auto args = MakeArgs("[numthreads(1, 1, 1)] void main() {}");
+    auto key  = KernelCompilationCache::ComputeKey(desc, args, "v1");
+
+    EXPECT_EQ(key.size(), 64);
+    EXPECT_EQ(key, KernelCompilationCache::ComputeKey(desc, args, "v1"));
+    EXPECT_NE(key, KernelCompilationCache::ComputeKey(desc, args, "v2"));
+
+    auto otherArgs = MakeArgs("[numthreads(2, 1, 1)] void main() {}");
+    EXPECT_NE(key, KernelCompilationCache::ComputeKey(desc, otherArgs, "v1"));
+
+    auto optimizedArgs              = args;
+    optimizedArgs.OptimizationLevel = CompilerOptimizationLevel::None;
+    EXPECT_NE(key, KernelCompilationCache::ComputeKey(desc, optimizedArgs, "v1"));
+
+    auto strippedArgs           = args;
+    strippedArgs.OptimizerFlags = SpirVOptimizerFlags::StripDebugInfo;
+    EXPECT_NE(key, KernelCompilationCache::ComputeKey(desc, strippedArgs, "v1"));
+
+    auto vulkan13Desc      = desc;
+    vulkan13Desc.TargetEnv = KernelTargetEnv::Vulkan1_3;
+    EXPECT_NE(key, KernelCompilationCache::ComputeKey(vulkan13Desc, args, "v1"));
+
+    auto sm66Desc        = desc;
+    sm66Desc.ShaderModel = KernelShaderModel::SM6_6;
+    EXPECT_NE(key, KernelCompilationCache::ComputeKey(sm66Desc, args, "v1"));
+
+    CompilerDefinition definitions[] = { CompilerDefinition("A", "1") };
+    auto definedArgs                 = args;
+    definedArgs.Definitions          = definitions;
+    EXPECT_NE(key, KernelCompilationCache::ComputeKey(desc, definedArgs, "v1"));
+}
+
+TEST(KernelCompilationCache, KeyDependsOnIncludes)
+{
+    KernelCompilerDesc desc("Test compiler");
+    auto args = MakeArgs("#include \"Random.hlsl\"");
+    EXPECT_NE(KernelCompilationCache::ComputeKey(desc, args, "v1", "includes1"),
+              KernelCompilationCache::ComputeKey(desc, args, "v1", "includes2"));
+}
+
+TEST(KernelCompilationCache, KeyDistinguishesNullDefinitionValues)
+{
+    KernelCompilerDesc desc("Test compiler");
+    CompilerDefinition nullValue[]  = { CompilerDefinition("A") };
+    CompilerDefinition emptyValue[] = { CompilerDefinition("A", "") };
+
+    auto nullArgs         = MakeArgs("");
+    nullArgs.Definitions  = nullValue;
+    auto emptyArgs        = MakeArgs("");
+    emptyArgs.Definitions = emptyValue;
+    EXPECT_NE(KernelCompilationCache::ComputeKey(desc, nullArgs, "v1"),
+              KernelCompilationCache::ComputeKey(desc, emptyArgs, "v1"));
+}
+
+TEST(KernelCompilationCache, EvictsLeastRecentlyUsed)
+{
+    Ptr<KernelCompilationCache> pCache;
+    KernelCompilationCache::Create(&pCache);
+    ASSERT_EQ(pCache->Init(KernelCompilationCacheDesc(nullptr, 2)), ResultCode::Success);
+
+    pCache->Put("a", MakeBytecode(1));
+    pCache->Put("b", MakeBytecode(2));
+
+    HeapArray<Byte> result;
+    EXPECT_TRUE(pCache->TryGet("a", &result));
+    EXPECT_EQ(result[0], static_cast<Byte>(1));
+
+    pCache->Put("c", MakeBytecode(3));
+    EXPECT_EQ(pCache->GetMemoryEntryCount(), 2);
+    EXPECT_TRUE(pCache->TryGet("a", &result));
+    EXPECT_FALSE(pCache->TryGet("b", &result));
+    EXPECT_TRUE(pCache->TryGet("c", &result));
+    EXPECT_EQ(result[0], static_cast<Byte>(3));
+}
+
+TEST(KernelCompilationCache, PersistsOnDisk)
+{
+    auto directory = (std::filesystem::temp_directory_path() / "UnComputeKernelCacheTest").string();
+    std::filesystem::remove_all(directory);
+
+    {
+        Ptr<KernelCompilationCache> pCache;
+        KernelCompilationCache::Create(&pCache);
+        ASSERT_EQ(pCache->Init(KernelCompilationCacheDesc(directory.c_str(), 0)), ResultCode::Success);
+        pCache->Put("kernel", MakeBytecode(42));
+        EXPECT_EQ(pCache->GetMemoryEntryCount(), 0);
+    }
+
+    Ptr<KernelCompilationCache> pCache;
+    KernelCompilationCache::Create(&pCache);
+    ASSERT_EQ(pCache->Init(KernelCompilationCacheDesc(directory.c_str(), 4)), ResultCode::Success);
+
+    HeapArray<Byte> result;
+    ASSERT_TRUE(pCache->TryGet("kernel", &result));
+    ASSERT_EQ(result.Length(), 4);
+    EXPECT_EQ(result[3], static_cast<Byte>(42));
+    EXPECT_EQ(pCache->GetMemoryEntryCount(), 1);
+    EXPECT_FALSE(pCache->TryGet("missing", &result));
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST(KernelCompilationCache, ConcurrentWritersLeaveNoTemporaryFiles)
+{
+    auto directory = (std::filesystem::temp_directory_path() / "UnComputeKernelCacheConcurrencyTest").string();
+    std::filesystem::remove_all(directory);
+
+    // Separate caches on the same directory behave like separate processes.
+    std::vector<std::thread> writers;
+    for (UInt8 i = 0; i < 8; ++i)
+    {
+        writers.emplace_back([&directory, i] {
+            Ptr<KernelCompilationCache> pCache;
+            KernelCompilationCache::Create(&pCache);
+            ASSERT_EQ(pCache->Init(KernelCompilationCacheDesc(directory.c_str(), 0)), ResultCode::Success);
+            for (Int32 j = 0; j < 16; ++j)
+            {
+                pCache->Put("kernel", HeapArray<Byte>(1024, static_cast<Byte>(i)));
+            }
+        });
+    }
+
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+
+    Ptr<KernelCompilationCache> pCache;
+    KernelCompilationCache::Create(&pCache);
+    ASSERT_EQ(pCache->Init(KernelCompilationCacheDesc(directory.c_str(), 0)), ResultCode::Success);
+
+    HeapArray<Byte> result;
+    ASSERT_TRUE(pCache->TryGet("kernel", &result));
+    ASSERT_EQ(result.Length(), 1024);
+    EXPECT_TRUE(std::all_of(result.begin(), result.end(), [&result](Byte value) {
+        return value == result[0];
+    }));
+
+    USize fileCount = 0;
+    for ([[maybe_unused]] auto& entry : std::filesystem::directory_iterator(directory))
+    {
+        ++fileCount;
+    }
+
+    EXPECT_EQ(fileCount, 1);
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,90 @@
+#include <Tests/Common/Common.h>
+#include <UnCompute/Compilation/KernelIncludeRegistry.h>
+#include <UnCompute/Memory/Ptr.h>
+#include <filesystem>
+#include <fstream>
+
+using namespace UN;
+
+namespace
+{
+    ArraySlice<const Byte> MakeSource(std::string_view source)
+    {
+        return ArraySlice(reinterpret_cast<const Byte*>(source.data()), source.size());
+    }
+
+    std::string_view ToString(ArraySlice<const Byte> source)
+    {
+        return std::string_view(reinterpret_cast<const char*>(source.Data()), source.Length());
+    }
+} // namespace
+
+TEST(KernelIncludeRegistry, NormalizesNames)
+{
+    EXPECT_EQ(KernelIncludeRegistry::NormalizeName("Random.hlsl"), "Random.hlsl");
+    EXPECT_EQ(KernelIncludeRegistry::NormalizeName("./Random.hlsl"), "Random.hlsl");
+    EXPECT_EQ(KernelIncludeRegistry::NormalizeName(".\\Math\\Random.hlsl"), "Math/Random.hlsl");
+    EXPECT_EQ(KernelIncludeRegistry::NormalizeName("Math/./Random.hlsl"), "Math/Random.hlsl");
+    EXPECT_EQ(KernelIncludeRegistry::NormalizeName("./Math/../Common.hlsl"), "Common.hlsl");
+    EXPECT_EQ(KernelIncludeRegistry::NormalizeName("./../Common.hlsl"), "../Common.hlsl");
+}
+
+TEST(KernelIncludeRegistry, FindsRegisteredIncludes)
+{
+    Ptr<KernelIncludeRegistry> pRegistry;
+    KernelIncludeRegistry::Create(&pRegistry);
+    ASSERT_EQ(pRegistry->Register("Math/Random.hlsl", MakeSource("uint Random();")), ResultCode::Success);
+
+    ArraySlice<const Byte> source;
+    ASSERT_TRUE(pRegistry->TryGet("./Math/Random.hlsl", &source));
+    EXPECT_EQ(ToString(source), "uint Random();");
+    ASSERT_TRUE(pRegistry->TryGet("./Common/../Math/Random.hlsl", &source));
+    EXPECT_EQ(ToString(source), "uint Random();");
+    EXPECT_FALSE(pRegistry->TryGet("Missing.hlsl", &source));
+}
+
+TEST(KernelIncludeRegistry, RejectsConflictingIncludes)
+{
+    Ptr<KernelIncludeRegistry> pRegistry;
+    KernelIncludeRegistry::Create(&pRegistry);
+    ASSERT_EQ(pRegistry->Register("A.hlsl", MakeSource("int a;")), ResultCode::Success);
+    EXPECT_EQ(pRegistry->Register("A.hlsl", MakeSource("int a;")), ResultCode::Success);
+    EXPECT_EQ(pRegistry->Register("A.hlsl", MakeSource("int b;")), ResultCode::InvalidArguments);
+    EXPECT_EQ(pRegistry->GetIncludeCount(), 1);
+}
+
+TEST(KernelIncludeRegistry, HashDependsOnIncludes)
+{
+    Ptr<KernelIncludeRegistry> pFirst;
+    Ptr<KernelIncludeRegistry> pSecond;
+    KernelIncludeRegistry::Create(&pFirst);
+    KernelIncludeRegistry::Create(&pSecond);
+
+    pFirst->Register("A.hlsl", MakeSource("int a;"));
+    pFirst->Register("B.hlsl", MakeSource("int b;"));
+    pSecond->Register("B.hlsl", MakeSource("int b;"));
+    EXPECT_NE(pFirst->GetHash(), pSecond->GetHash());
+
+    pSecond->Register("A.hlsl", MakeSource("int a;"));
+    EXPECT_EQ(pFirst->GetHash(), pSecond->GetHash());
+}
+
+TEST(KernelIncludeRegistry, RegistersFiles)
+{
+    auto path = (std::filesystem::temp_directory_path() / "UnComputeIncludeTest.hlsl").string();
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "float Pi();";
+    }
+
+    Ptr<KernelIncludeRegistry> pRegistry;
+    KernelIncludeRegistry::Create(&pRegistry);
+    ASSERT_EQ(pRegistry->RegisterFile("Pi.hlsl", path.c_str()), ResultCode::Success);
+
+    ArraySlice<const Byte> source;
+    ASSERT_TRUE(pRegistry->TryGet("Pi.hlsl", &source));
+    EXPECT_EQ(ToString(source), "float Pi();");
+
+    std::filesystem::remove(path);
+    EXPECT_NE(pRegistry->RegisterFile("Missing.hlsl", path.c_str()), ResultCode::Success);
+}
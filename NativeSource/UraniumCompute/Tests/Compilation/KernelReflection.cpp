@@ -0,0 +1,169 @@
+#include <Tests/Common/Common.h>
+#include <UnCompute/Compilation/KernelReflection.h>
+#include <cstring>
+#include <vector>
+
+using namespace UN;
+
+namespace
+{
+    //! \brief Writes SPIR-V modules word by word.
+    class SpirVWriter
+    {
+        std::vector<UInt32> m_Words = { 0x07230203, 0x00010300, 0, 100, 0 };
+
+    public:
+        inline void Emit(UInt32 opcode, std::initializer_list<UInt32> operands)
+        {
+            m_Words.push_back(static_cast<UInt32>(operands.size() + 1) << 16 | opcode);
+            m_Words.insert(m_Words.end(), operands);
+        }
+
+        inline void EmitEntryPoint(UInt32 id, const char* name)
+        {
+            std::vector<UInt32> nameWords((strlen(name) + sizeof(UInt32)) / sizeof(UInt32));
+            memcpy(nameWords.data(), name, strlen(name));
+
+            m_Words.push_back(static_cast<UInt32>(nameWords.size() + 3) << 16 | 15);
+            m_Words.push_back(5);
+            m_Words.push_back(id);
+            m_Words.insert(m_Words.end(), nameWords.begin(), nameWords.end());
+        }
+
+        [[nodiscard]] inline ArraySlice<const Byte> GetBytecode() const
+        {
+            auto* pBytes = reinterpret_cast<const Byte*>(m_Words.data());
+            return ArraySlice(pBytes, pBytes + m_Words.size() * sizeof(UInt32));
+        }
+    };
+
+    // Equivalent of:
+    //
+    // StructuredBuffer<float> Input : register(t0);
+    // RWStructuredBuffer<float> Output : register(u1);
+    // cbuffer Constants : register(b2) { float4 Scale; uint Count; };
+    // RWBuffer<float> Texels : register(u3);
+    // [[vk::push_constant]] struct { uint First; uint Last; } Range;
+    //
+    // [numthreads(64, 2, 1)]
+    // void main() {}
+    SpirVWriter MakeModule()
+    {
+        enum : UInt32
+        {
+            Main = 1,
+            Float,
+            UInt,
+            FloatArray,
+            InputStruct,
+            InputPointer,
+            Input,
+            OutputStruct,
+            OutputPointer,
+            Output,
+            Float4,
+            ConstantsStruct,
+            ConstantsPointer,
+            Constants,
+            TexelImage,
+            TexelPointer,
+            Texels,
+            RangeStruct,
+            RangePointer,
+            Range
+        };
+
+        SpirVWriter writer;
+        writer.EmitEntryPoint(Main, "main");
+        writer.Emit(16, { Main, 17, 64, 2, 1 });
+
+        writer.Emit(71, { FloatArray, 6, 4 });
+        writer.Emit(71, { InputStruct, 2 });
+        writer.Emit(72, { InputStruct, 0, 35, 0 });
+        writer.Emit(72, { InputStruct, 0, 24 });
+        writer.Emit(71, { Input, 33, 0 });
+        writer.Emit(71, { Input, 34, 0 });
+        writer.Emit(71, { OutputStruct, 2 });
+        writer.Emit(72, { OutputStruct, 0, 35, 0 });
+        writer.Emit(71, { Output, 33, 1 });
+        writer.Emit(71, { Output, 34, 0 });
+        writer.Emit(71, { ConstantsStruct, 2 });
+        writer.Emit(72, { ConstantsStruct, 0, 35, 0 });
+        writer.Emit(72, { ConstantsStruct, 1, 35, 16 });
+        writer.Emit(71, { Constants, 33, 2 });
+        writer.Emit(71, { Constants, 34, 0 });
+        writer.Emit(71, { Texels, 33, 3 });
+        writer.Emit(71, { Texels, 34, 0 });
+        writer.Emit(71, { RangeStruct, 2 });
+        writer.Emit(72, { RangeStruct, 0, 35, 0 });
+        writer.Emit(72, { RangeStruct, 1, 35, 4 });
+
+        writer.Emit(22, { Float, 32 });
+        writer.Emit(21, { UInt, 32, 0 });
+        writer.Emit(29, { FloatArray, Float });
+        writer.Emit(30, { InputStruct, FloatArray });
+        writer.Emit(32, { InputPointer, 12, InputStruct });
+        writer.Emit(30, { OutputStruct, FloatArray });
+        writer.Emit(32, { OutputPointer, 12, OutputStruct });
+        writer.Emit(23, { Float4, Float, 4 });
+        writer.Emit(30, { ConstantsStruct, Float4, UInt });
+        writer.Emit(32, { ConstantsPointer, 2, ConstantsStruct });
+        writer.Emit(25, { TexelImage, Float, 5, 2, 0, 0, 2, 3 });
+        writer.Emit(32, { TexelPointer, 0, TexelImage });
+        writer.Emit(30, { RangeStruct, UInt, UInt });
+        writer.Emit(32, { RangePointer, 9, RangeStruct });
+
+        writer.Emit(59, { InputPointer, Input, 12 });
+        writer.Emit(59, { OutputPointer, Output, 12 });
+        writer.Emit(59, { ConstantsPointer, Constants, 2 });
+        writer.Emit(59, { TexelPointer, Texels, 0 });
+        writer.Emit(59, { RangePointer, Range, 9 });
+        return writer;
+    }
+} // namespace
+
+TEST(KernelReflection, ReadsWorkgroupSize)
+{
+    auto module = MakeModule();
+    KernelReflection reflection;
+    ASSERT_EQ(KernelReflection::FromSpirV(module.GetBytecode(), "main", &reflection), ResultCode::Success);
+    EXPECT_EQ(reflection.LocalSize, WorkgroupSize(64, 2, 1));
+    EXPECT_EQ(reflection.LocalSize.GetInvocationCount(), 128);
+    EXPECT_EQ(reflection.LocalSize.GetGroupCountX(1000), 16);
+    EXPECT_EQ(reflection.LocalSize.GetGroupCountY(3), 2);
+}
+
+TEST(KernelReflection, ReadsResources)
+{
+    auto module = MakeModule();
+    KernelReflection reflection;
+    ASSERT_EQ(KernelReflection::FromSpirV(module.GetBytecode(), nullptr, &reflection), ResultCode::Success);
+
+    ASSERT_EQ(reflection.ResourceLayout.Length(), 4);
+    EXPECT_EQ(reflection.ResourceLayout[0], KernelResourceDesc(0, KernelResourceKind::Buffer));
+    EXPECT_EQ(reflection.ResourceLayout[1], KernelResourceDesc(1, KernelResourceKind::RWBuffer));
+    EXPECT_EQ(reflection.ResourceLayout[2], KernelResourceDesc(2, KernelResourceKind::ConstantBuffer));
+    EXPECT_EQ(reflection.ResourceLayout[3], KernelResourceDesc(3, KernelResourceKind::RWBuffer, Format::R32_SFloat));
+
+    ASSERT_EQ(reflection.ResourceSizes.Length(), 4);
+    EXPECT_EQ(reflection.ResourceSizes[0], 4);
+    EXPECT_EQ(reflection.ResourceSizes[1], 4);
+    EXPECT_EQ(reflection.ResourceSizes[2], 20);
+    EXPECT_EQ(reflection.ResourceSizes[3], 0);
+
+    ASSERT_EQ(reflection.PushConstantRanges.Length(), 1);
+    EXPECT_EQ(reflection.PushConstantRanges[0].Offset, 0);
+    EXPECT_EQ(reflection.PushConstantRanges[0].Size, 8);
+}
+
+TEST(KernelReflection, RejectsInvalidBytecode)
+{
+    KernelReflection reflection;
+    UInt32 words[] = { 0x12345678, 0, 0, 0, 0 };
+    auto* pBytes   = reinterpret_cast<const Byte*>(words);
+    EXPECT_NE(KernelReflection::FromSpirV(ArraySlice(pBytes, pBytes + sizeof(words)), nullptr, &reflection),
+              ResultCode::Success);
+
+    auto module = MakeModule();
+    EXPECT_NE(KernelReflection::FromSpirV(module.GetBytecode(), "missing", &reflection), ResultCode::Success);
+}
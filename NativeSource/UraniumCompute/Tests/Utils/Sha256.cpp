@@ -0,0 +1,42 @@
+#include <Tests/Common/Common.h>
+#include <UnCompute/Utils/Sha256.h>
+
+using namespace UN;
+
+namespace
+{
+    std::string HashString(std::string_view str)
+    {
+        Sha256 hash;
+        hash.Update(str.data(), str.size());
+        return Sha256::ToHex(hash.Finalize());
+    }
+} // namespace
+
+TEST(Sha256, EmptyInput)
+{
+    EXPECT_EQ(HashString(""), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+}
+
+TEST(Sha256, ShortInput)
+{
+    EXPECT_EQ(HashString("abc"), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+}
+
+TEST(Sha256, MultiBlockInput)
+{
+    EXPECT_EQ(HashString("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"),
+              "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+}
+
+TEST(Sha256, IncrementalUpdate)
+{
+    std::string input(1000, 'a');
+    Sha256 hash;
+    for (USize i = 0; i < input.size(); i += 7)
+    {
+        hash.Update(input.data() + i, std::min<USize>(7, input.size() - i));
+    }
+
+    EXPECT_EQ(Sha256::ToHex(hash.Finalize()), HashString(input));
+}
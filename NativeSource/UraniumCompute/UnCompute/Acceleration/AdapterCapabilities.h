@@ -0,0 +1,35 @@
+#pragma once
+#include <UnCompute/Acceleration/AdapterInfo.h>
+#include <UnCompute/Backend/MemoryKindFlags.h>
+
+namespace UN
+{
+    //! \brief Description of a device memory heap.
+    struct MemoryHeapInfo
+    {
+        UInt64 Size;          //!< Size of the heap in bytes.
+        MemoryKindFlags Kind; //!< Kinds of memory that can be allocated from the heap.
+    };
+
+    //! \brief Capabilities and limits of backend's hardware adapter.
+    //!
+    //! Can be used to choose workgroup and tile sizes without creating a compute device.
+    struct AdapterCapabilities
+    {
+        inline static constexpr UInt32 MaxMemoryHeaps = 16; //!< Maximum number of memory heaps an adapter can report.
+
+        UInt32 MaxWorkgroupSize[3];                 //!< Maximum number of invocations in a workgroup along each dimension.
+        UInt32 MaxWorkgroupCount[3];                //!< Maximum number of workgroups in a single dispatch along each dimension.
+        UInt32 MaxWorkgroupInvocations;             //!< Maximum total number of invocations in a workgroup.
+        UInt32 MaxSharedMemorySize;                 //!< Maximum size of groupshared memory per workgroup in bytes.
+        UInt32 MaxStorageBufferRange;               //!< Maximum size of a buffer bound to a kernel in bytes.
+        UInt32 SubgroupSize;                        //!< Default number of invocations in a subgroup (wave).
+        UInt32 MinSubgroupSize;                     //!< Minimum value of KernelDesc::RequiredSubgroupSize, zero if not supported.
+        UInt32 MaxSubgroupSize;                     //!< Maximum value of KernelDesc::RequiredSubgroupSize, zero if not supported.
+        SubgroupOperationFlags SubgroupOperations;  //!< Subgroup operations supported in compute kernels.
+        Float32 TimestampPeriod;                    //!< Nanoseconds per timestamp tick, zero if timestamps are not supported.
+        DeviceFeatureFlags SupportedFeatures;       //!< Optional device features supported by the adapter.
+        UInt32 MemoryHeapCount;                     //!< Number of valid elements in MemoryHeaps.
+        MemoryHeapInfo MemoryHeaps[MaxMemoryHeaps]; //!< Device memory heaps.
+    };
+} // namespace UN
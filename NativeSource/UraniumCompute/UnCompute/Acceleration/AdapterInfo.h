@@ -1,4 +1,5 @@
 #pragma once
+#include <UnCompute/Backend/BaseTypes.h>
 #include <UnCompute/Base/Base.h>
 
 namespace UN
@@ -13,11 +14,43 @@ namespace UN
         Cpu
     };
 
+    //! \brief Subgroup (wave) operations that can be used in compute kernels.
+    //!
+    //! The values match the corresponding HLSL intrinsic groups, e.g. Arithmetic is required for WaveActiveSum
+    //! and WavePrefixSum, Ballot is required for WaveActiveBallot.
+    enum class SubgroupOperationFlags
+    {
+        None            = 0,
+        Basic           = UN_BIT(0), //!< WaveGetLaneIndex, WaveGetLaneCount, WaveIsFirstLane.
+        Vote            = UN_BIT(1), //!< WaveActiveAnyTrue, WaveActiveAllTrue, WaveActiveAllEqual.
+        Arithmetic      = UN_BIT(2), //!< WaveActiveSum, WaveActiveMin, WavePrefixSum, etc.
+        Ballot          = UN_BIT(3), //!< WaveActiveBallot, WaveReadLaneFirst, WaveReadLaneAt.
+        Shuffle         = UN_BIT(4), //!< Arbitrary lane shuffles.
+        ShuffleRelative = UN_BIT(5), //!< Lane shuffles relative to the current lane.
+        Clustered       = UN_BIT(6), //!< Operations on clusters of lanes.
+        Quad            = UN_BIT(7)  //!< QuadReadAcrossX, QuadReadAcrossY, etc.
+    };
+
+    UN_ENUM_OPERATORS(SubgroupOperationFlags);
+
     //! \brief Description of backend's hardware adapter.
     struct AdapterInfo
     {
-        UInt32 Id;        //!< Adapter ID, used to create a compute device on it.
-        AdapterKind Kind; //!< Kind of adapter (integrated, discrete, etc.)
-        char Name[256];   //!< Name of adapter.
+        inline static constexpr UInt32 UuidSize = 16; //!< Size of AdapterInfo::DeviceUuid in bytes.
+
+        UInt32 Id;                                 //!< Adapter ID, used to create a compute device on it.
+        AdapterKind Kind;                          //!< Kind of adapter (integrated, discrete, etc.)
+        char Name[256];                            //!< Name of adapter.
+        UInt32 SubgroupSize;                       //!< Default number of invocations in a subgroup (wave).
+        UInt32 MinSubgroupSize;                    //!< Minimum value of KernelDesc::RequiredSubgroupSize, zero if not supported.
+        UInt32 MaxSubgroupSize;                    //!< Maximum value of KernelDesc::RequiredSubgroupSize, zero if not supported.
+        SubgroupOperationFlags SubgroupOperations; //!< Subgroup operations supported in compute kernels.
+        UInt32 MaxWorkgroupCount[3];               //!< Maximum number of workgroups in a single dispatch along each dimension.
+        DeviceFeatureFlags SupportedFeatures;      //!< Optional device features supported by the adapter.
+        KernelTargetEnv TargetEnv;                 //!< Newest kernel target environment, see KernelCompilerDesc::TargetEnv.
+        KernelShaderModel ShaderModel;             //!< Newest kernel shader model, see KernelCompilerDesc::ShaderModel.
+
+        //! \brief Universally unique identifier of the adapter, stays the same across processes and driver versions.
+        UInt8 DeviceUuid[UuidSize];
     };
 } // namespace UN
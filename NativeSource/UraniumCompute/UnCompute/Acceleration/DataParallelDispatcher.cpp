@@ -0,0 +1,387 @@
+#include <UnCompute/Acceleration/DataParallelDispatcher.h>
+#include <UnCompute/Backend/IFence.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <limits>
+#include <mutex>
+
+namespace UN
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        //! \brief Completion of the command lists submitted by a single DataParallelDispatcher::Run() call.
+        struct RunCompletion
+        {
+            std::mutex Mutex;
+            std::condition_variable Condition;
+            USize PendingCount = 0;
+        };
+
+        //! \brief Completion of the command list submitted to a single device.
+        struct DeviceCompletion
+        {
+            RunCompletion* pRun = nullptr;
+            Clock::time_point SubmitTime;
+            Clock::time_point CompleteTime;
+            ResultCode Result = ResultCode::Success;
+        };
+
+        void OnDeviceCompleted(ICommandList*, ResultCode result, void* pUserData)
+        {
+            auto* pCompletion = static_cast<DeviceCompletion*>(pUserData);
+            auto* pRun        = pCompletion->pRun;
+
+            std::lock_guard lock(pRun->Mutex);
+            pCompletion->CompleteTime = Clock::now();
+            pCompletion->Result       = result;
+            --pRun->PendingCount;
+            pRun->Condition.notify_all();
+        }
+    } // namespace
+
+    inline KernelResourceKind GetKernelResourceKind(DataParallelBufferKind kind)
+    {
+        return kind == DataParallelBufferKind::SplitOutput ? KernelResourceKind::RWBuffer : KernelResourceKind::Buffer;
+    }
+
+    ResultCode DataParallelDispatcher::Init(const DataParallelDispatcherDesc& desc)
+    {
+        if (desc.Devices.Empty())
+        {
+            UN_Error(false, "DataParallelDispatcherDesc::Devices must have at least one device");
+            return ResultCode::InvalidArguments;
+        }
+        if (desc.WorkgroupSize == 0)
+        {
+            UN_Error(false, "DataParallelDispatcherDesc::WorkgroupSize must not be zero");
+            return ResultCode::InvalidArguments;
+        }
+
+        for (auto& buffer : desc.Buffers)
+        {
+            if (buffer.ElementSize == 0)
+            {
+                UN_Error(false, "Element size of the buffer at binding index {} must not be zero", buffer.BindingIndex);
+                return ResultCode::InvalidArguments;
+            }
+        }
+
+        m_Name          = desc.Name ? desc.Name : "Data-parallel dispatcher";
+        m_WorkgroupSize = desc.WorkgroupSize;
+        m_Buffers.assign(desc.Buffers.begin(), desc.Buffers.end());
+
+        m_Devices.clear();
+        m_Devices.resize(desc.Devices.Length());
+        for (USize i = 0; i < desc.Devices.Length(); ++i)
+        {
+            m_Devices[i].pDevice = desc.Devices[i];
+            if (auto result = InitDevice(m_Devices[i], desc.Bytecode); Failed(result))
+            {
+                return result;
+            }
+        }
+
+        return ResultCode::Success;
+    }
+
+    ResultCode DataParallelDispatcher::InitDevice(DeviceContext& context, ArraySlice<const Byte> bytecode)
+    {
+        std::vector<KernelResourceDesc> layout;
+        layout.reserve(m_Buffers.size());
+        for (auto& buffer : m_Buffers)
+        {
+            layout.emplace_back(buffer.BindingIndex, GetKernelResourceKind(buffer.Kind));
+        }
+
+        UN_VerifyResult(context.pDevice->CreateResourceBinding(&context.pResourceBinding), "Couldn't create resource binding");
+        if (auto result = context.pResourceBinding->Init(ResourceBindingDesc(m_Name.c_str(), layout)); Failed(result))
+        {
+            return result;
+        }
+
+        UN_VerifyResult(context.pDevice->CreateKernel(&context.pKernel), "Couldn't create kernel");
+        if (auto result = context.pKernel->Init(KernelDesc(m_Name.c_str(), context.pResourceBinding.Get(), bytecode));
+            Failed(result))
+        {
+            return result;
+        }
+
+        UN_VerifyResult(context.pDevice->CreateCommandList(&context.pCommandList), "Couldn't create command list");
+        if (auto result = context.pCommandList->Init(CommandListDesc(m_Name.c_str(), HardwareQueueKindFlags::Compute));
+            Failed(result))
+        {
+            return result;
+        }
+
+        context.Buffers.resize(m_Buffers.size());
+        return ResultCode::Success;
+    }
+
+    ResultCode DataParallelDispatcher::PrepareBuffer(DeviceContext& context, USize bufferIndex, UInt64 byteSize)
+    {
+        auto& storage = context.Buffers[bufferIndex];
+
+        // The kernel checks the bounds against the length of the buffer, so it must have the exact size of the part.
+        // The memory is only reallocated when the part grows.
+        if (storage.pBuffer && storage.pBuffer->GetDesc().Size == byteSize)
+        {
+            return ResultCode::Success;
+        }
+
+        storage.pBuffer.Reset();
+        UN_VerifyResult(context.pDevice->CreateBuffer(&storage.pBuffer), "Couldn't create buffer");
+        if (auto result = storage.pBuffer->Init(BufferDesc(m_Name.c_str(), byteSize)); Failed(result))
+        {
+            return result;
+        }
+
+        if (byteSize > storage.Capacity || !storage.pMemory->IsCompatible(storage.pBuffer.Get()))
+        {
+            storage.pStagingBuffer.Reset();
+            UN_VerifyResult(context.pDevice->CreateBuffer(&storage.pStagingBuffer), "Couldn't create buffer");
+            if (auto result = storage.pStagingBuffer->Init(BufferDesc(m_Name.c_str(), byteSize)); Failed(result))
+            {
+                return result;
+            }
+
+            IDeviceObject* pBuffer = storage.pBuffer.Get();
+            storage.pMemory.Reset();
+            UN_VerifyResult(context.pDevice->CreateMemory(&storage.pMemory), "Couldn't create device memory");
+            auto memoryDesc = DeviceMemoryDesc(m_Name.c_str(), MemoryKindFlags::DeviceAccessible, byteSize, { &pBuffer, 1 });
+            if (auto result = storage.pMemory->Init(memoryDesc); Failed(result))
+            {
+                return result;
+            }
+
+            IDeviceObject* pStagingBuffer = storage.pStagingBuffer.Get();
+            storage.pStagingMemory.Reset();
+            UN_VerifyResult(context.pDevice->CreateMemory(&storage.pStagingMemory), "Couldn't create device memory");
+            memoryDesc =
+                DeviceMemoryDesc(m_Name.c_str(), MemoryKindFlags::HostAndDeviceAccessible, byteSize, { &pStagingBuffer, 1 });
+            if (auto result = storage.pStagingMemory->Init(memoryDesc); Failed(result))
+            {
+                return result;
+            }
+
+            if (auto result = storage.pStagingBuffer->BindMemory(storage.pStagingMemory.Get()); Failed(result))
+            {
+                return result;
+            }
+
+            storage.Capacity = byteSize;
+        }
+
+        return storage.pBuffer->BindMemory(storage.pMemory.Get());
+    }
+
+    ResultCode DataParallelDispatcher::RecordCommands(DeviceContext& context, ArraySlice<void* const> data, UInt64 elementOffset,
+                                                      UInt64 elementCount)
+    {
+        for (USize i = 0; i < m_Buffers.size(); ++i)
+        {
+            auto& buffer = m_Buffers[i];
+            auto isSplit = buffer.Kind != DataParallelBufferKind::BroadcastInput;
+            auto size    = isSplit ? elementCount * buffer.ElementSize : buffer.ElementSize;
+            if (auto result = PrepareBuffer(context, i, size); Failed(result))
+            {
+                return result;
+            }
+
+            auto& storage = context.Buffers[i];
+            if (auto result = context.pResourceBinding->SetVariable(buffer.BindingIndex, storage.pBuffer.Get()); Failed(result))
+            {
+                return result;
+            }
+
+            if (buffer.Kind != DataParallelBufferKind::SplitOutput)
+            {
+                auto* pSource = static_cast<const Byte*>(data[i]) + (isSplit ? elementOffset * buffer.ElementSize : 0);
+                void* pMapped;
+                if (auto result = storage.pStagingMemory->Map(0, size, &pMapped); Failed(result))
+                {
+                    return result;
+                }
+
+                memcpy(pMapped, pSource, size);
+                storage.pStagingMemory->Unmap();
+            }
+        }
+
+        // The grid is dispatched along X only, so its part must fit into a single dispatch on this device.
+        auto maxGroupCount  = std::min<UInt64>(context.pDevice->GetAdapterInfo().MaxWorkgroupCount[0],
+                                              std::numeric_limits<Int32>::max());
+        auto workgroupCount = (elementCount + m_WorkgroupSize - 1) / m_WorkgroupSize;
+        if (workgroupCount > maxGroupCount)
+        {
+            UN_Error(false,
+                     "Too many workgroups for a single device: {}, the limit is {}, increase the workgroup size",
+                     workgroupCount,
+                     maxGroupCount);
+            return ResultCode::InvalidArguments;
+        }
+
+        auto& pCommandList = context.pCommandList;
+        if (pCommandList->GetState() != CommandListState::Initial)
+        {
+            pCommandList->ResetState();
+        }
+
+        auto builder = pCommandList->Begin();
+        if (!builder)
+        {
+            return ResultCode::InvalidOperation;
+        }
+
+        for (USize i = 0; i < m_Buffers.size(); ++i)
+        {
+            auto& storage = context.Buffers[i];
+            if (m_Buffers[i].Kind != DataParallelBufferKind::SplitOutput)
+            {
+                auto size = storage.pBuffer->GetDesc().Size;
+                builder.Copy(storage.pStagingBuffer.Get(), storage.pBuffer.Get(), BufferCopyRegion(size));
+                builder.MemoryBarrier(storage.pBuffer.Get(),
+                                      MemoryBarrierDesc(AccessFlags::TransferWrite, AccessFlags::KernelRead));
+            }
+        }
+
+        builder.Dispatch(context.pKernel.Get(), static_cast<Int32>(workgroupCount), 1, 1);
+
+        for (USize i = 0; i < m_Buffers.size(); ++i)
+        {
+            auto& storage = context.Buffers[i];
+            if (m_Buffers[i].Kind == DataParallelBufferKind::SplitOutput)
+            {
+                auto size = storage.pBuffer->GetDesc().Size;
+                builder.MemoryBarrier(storage.pBuffer.Get(),
+                                      MemoryBarrierDesc(AccessFlags::KernelWrite, AccessFlags::TransferRead));
+                builder.Copy(storage.pBuffer.Get(), storage.pStagingBuffer.Get(), BufferCopyRegion(size));
+                builder.MemoryBarrier(storage.pStagingBuffer.Get(),
+                                      MemoryBarrierDesc(AccessFlags::TransferWrite, AccessFlags::HostRead));
+            }
+        }
+
+        builder.End();
+        return ResultCode::Success;
+    }
+
+    ResultCode DataParallelDispatcher::ReadOutputs(DeviceContext& context, ArraySlice<void* const> data, UInt64 elementOffset,
+                                             UInt64 elementCount)
+    {
+        for (USize i = 0; i < m_Buffers.size(); ++i)
+        {
+            auto& buffer = m_Buffers[i];
+            if (buffer.Kind != DataParallelBufferKind::SplitOutput)
+            {
+                continue;
+            }
+
+            auto size     = elementCount * buffer.ElementSize;
+            auto* pResult = static_cast<Byte*>(data[i]) + elementOffset * buffer.ElementSize;
+            void* pMapped;
+            if (auto result = context.Buffers[i].pStagingMemory->Map(0, size, &pMapped); Failed(result))
+            {
+                return result;
+            }
+
+            memcpy(pResult, pMapped, size);
+            context.Buffers[i].pStagingMemory->Unmap();
+        }
+
+        return ResultCode::Success;
+    }
+
+    ResultCode DataParallelDispatcher::Run(UInt64 elementCount, ArraySlice<void* const> data)
+    {
+        if (data.Length() != m_Buffers.size())
+        {
+            UN_Error(false, "Expected data for {} buffers, but got {}", m_Buffers.size(), data.Length());
+            return ResultCode::InvalidArguments;
+        }
+
+        if (elementCount == 0)
+        {
+            return ResultCode::Success;
+        }
+
+        // Split evenly until every device has been measured, the throughputs are not comparable otherwise.
+        std::vector<Float64> weights(m_Devices.size());
+        auto allMeasured = std::all_of(m_Devices.begin(), m_Devices.end(), [](const DeviceContext& context) {
+            return context.Throughput > 0;
+        });
+        for (USize i = 0; i < m_Devices.size() && allMeasured; ++i)
+        {
+            weights[i] = m_Devices[i].Throughput;
+        }
+
+        auto workgroupCount = (elementCount + m_WorkgroupSize - 1) / m_WorkgroupSize;
+        std::vector<UInt64> workgroups(m_Devices.size());
+        SplitWorkgroups(workgroupCount, weights, workgroups);
+
+        std::vector<UInt64> offsets(m_Devices.size());
+        std::vector<UInt64> counts(m_Devices.size());
+        std::vector<DeviceCompletion> completions(m_Devices.size());
+        std::vector<bool> submitted(m_Devices.size());
+        RunCompletion run;
+
+        auto result        = ResultCode::Success;
+        UInt64 firstOffset = 0;
+        for (USize i = 0; i < m_Devices.size(); ++i)
+        {
+            offsets[i] = firstOffset;
+            counts[i]  = std::min(workgroups[i] * m_WorkgroupSize, elementCount - firstOffset);
+            firstOffset += counts[i];
+
+            if (counts[i] == 0 || Failed(result))
+            {
+                continue;
+            }
+
+            result = RecordCommands(m_Devices[i], data, offsets[i], counts[i]);
+            if (Succeeded(result))
+            {
+                // The timing starts at submission, so that the host upload doesn't skew the throughput of the device.
+                std::lock_guard lock(run.Mutex);
+                completions[i].pRun       = &run;
+                completions[i].SubmitTime = Clock::now();
+                result                    = m_Devices[i].pCommandList->Submit(&OnDeviceCompleted, &completions[i]);
+                submitted[i]              = Succeeded(result);
+                run.PendingCount += submitted[i] ? 1 : 0;
+            }
+
+            UN_Error(Succeeded(result), "Couldn't dispatch the kernel on device {}, error was {}", i, result);
+        }
+
+        // The command lists and the completions must outlive the submitted work even if a later submission failed.
+        {
+            std::unique_lock lock(run.Mutex);
+            run.Condition.wait(lock, [&run] {
+                return run.PendingCount == 0;
+            });
+        }
+
+        for (USize i = 0; i < m_Devices.size(); ++i)
+        {
+            auto& completion = completions[i];
+            if (!submitted[i] || Failed(result))
+            {
+                continue;
+            }
+
+            result = Failed(completion.Result) ? completion.Result : ReadOutputs(m_Devices[i], data, offsets[i], counts[i]);
+            if (Succeeded(result))
+            {
+                auto seconds    = std::chrono::duration<Float64>(completion.CompleteTime - completion.SubmitTime).count();
+                auto throughput = static_cast<Float64>(counts[i]) / std::max(seconds, 1e-9);
+
+                auto& context      = m_Devices[i];
+                context.Throughput = context.Throughput > 0 ? (context.Throughput + throughput) * 0.5 : throughput;
+            }
+        }
+
+        return result;
+    }
+} // namespace UN
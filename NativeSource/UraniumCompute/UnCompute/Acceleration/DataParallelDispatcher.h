@@ -0,0 +1,180 @@
+#pragma once
+#include <UnCompute/Backend/ICommandList.h>
+#include <UnCompute/Backend/IComputeDevice.h>
+#include <UnCompute/Backend/IKernel.h>
+#include <UnCompute/Backend/IResourceBinding.h>
+#include <UnCompute/Containers/ArraySlice.h>
+#include <UnCompute/Memory/Memory.h>
+#include <vector>
+
+namespace UN
+{
+    //! \brief Describes how a buffer of a data-parallel dispatch is distributed across the devices.
+    enum class DataParallelBufferKind
+    {
+        SplitInput,     //!< Read-only buffer split along the dispatch grid, each device receives only its part.
+        BroadcastInput, //!< Read-only buffer copied to every device as a whole, e.g. model parameters.
+        SplitOutput     //!< Writable buffer split along the dispatch grid, the parts are gathered back to the host.
+    };
+
+    //! \brief Buffer of a data-parallel dispatch.
+    struct DataParallelBufferDesc
+    {
+        Int32 BindingIndex          = -1;                                 //!< Binding index in the compute shader source.
+        DataParallelBufferKind Kind = DataParallelBufferKind::SplitInput; //!< How the buffer is distributed.
+
+        //! \brief Size of a single grid element in bytes for split buffers, or size of the whole buffer for broadcast ones.
+        UInt64 ElementSize = 0;
+
+        inline DataParallelBufferDesc() = default;
+
+        inline DataParallelBufferDesc(Int32 bindingIndex, DataParallelBufferKind kind, UInt64 elementSize)
+            : BindingIndex(bindingIndex)
+            , Kind(kind)
+            , ElementSize(elementSize)
+        {
+        }
+    };
+
+    //! \brief Data-parallel dispatcher descriptor.
+    struct DataParallelDispatcherDesc
+    {
+        const char* Name = nullptr;                       //!< Dispatcher debug name, used for the created device objects.
+        ArraySlice<IComputeDevice* const> Devices;        //!< Devices to split the work across.
+        ArraySlice<const Byte> Bytecode;                  //!< Kernel bytecode, must be compatible with all the devices.
+        ArraySlice<const DataParallelBufferDesc> Buffers; //!< Buffers bound to the kernel.
+        UInt32 WorkgroupSize = 1;                         //!< Number of grid elements processed by a single workgroup.
+
+        inline DataParallelDispatcherDesc() = default;
+
+        inline DataParallelDispatcherDesc(const char* name, ArraySlice<IComputeDevice* const> devices,
+                                          ArraySlice<const Byte> bytecode, ArraySlice<const DataParallelBufferDesc> buffers,
+                                          UInt32 workgroupSize)
+            : Name(name)
+            , Devices(devices)
+            , Bytecode(bytecode)
+            , Buffers(buffers)
+            , WorkgroupSize(workgroupSize)
+        {
+        }
+    };
+
+    //! \brief Runs a kernel on a one-dimensional grid split across multiple compute devices.
+    //!
+    //! The grid is split into contiguous parts proportionally to the measured throughput of each device: the first
+    //! call to Run() splits it evenly, the following calls use the number of elements processed per second by the
+    //! previous runs. The dispatcher uploads the inputs, dispatches the kernel on all the devices at the same time
+    //! and gathers the outputs back to the host memory.
+    //!
+    //! Each device only sees its own part of split buffers starting at index zero, the last workgroup can be partial,
+    //! so the kernel must check the element index against the length of the buffer.
+    class DataParallelDispatcher final : public Object<IObject>
+    {
+        struct BufferStorage
+        {
+            Ptr<IBuffer> pBuffer;
+            Ptr<IBuffer> pStagingBuffer;
+            Ptr<IDeviceMemory> pMemory;
+            Ptr<IDeviceMemory> pStagingMemory;
+            UInt64 Capacity = 0;
+        };
+
+        struct DeviceContext
+        {
+            Ptr<IComputeDevice> pDevice;
+            Ptr<IResourceBinding> pResourceBinding;
+            Ptr<IKernel> pKernel;
+            Ptr<ICommandList> pCommandList;
+            std::vector<BufferStorage> Buffers;
+            Float64 Throughput = 0; //!< Grid elements processed per second by the previous runs, zero if unknown.
+        };
+
+        std::string m_Name;
+        std::vector<DataParallelBufferDesc> m_Buffers;
+        std::vector<DeviceContext> m_Devices;
+        UInt32 m_WorkgroupSize = 1;
+
+        ResultCode InitDevice(DeviceContext& context, ArraySlice<const Byte> bytecode);
+        ResultCode PrepareBuffer(DeviceContext& context, USize bufferIndex, UInt64 byteSize);
+        ResultCode RecordCommands(DeviceContext& context, ArraySlice<void* const> data, UInt64 elementOffset,
+                                  UInt64 elementCount);
+        ResultCode ReadOutputs(DeviceContext& context, ArraySlice<void* const> data, UInt64 elementOffset,
+                               UInt64 elementCount);
+
+    public:
+        inline DataParallelDispatcher() = default;
+        ~DataParallelDispatcher() override = default;
+
+        //! \brief Create kernels and command lists on all the devices.
+        //!
+        //! \param desc - Dispatcher descriptor.
+        //!
+        //! \return ResultCode::Success or an error code.
+        ResultCode Init(const DataParallelDispatcherDesc& desc);
+
+        //! \brief Run the kernel on all the devices and wait for the results.
+        //!
+        //! \param elementCount - Number of elements in the grid.
+        //! \param data         - Host data for every buffer in DataParallelDispatcherDesc::Buffers in the same order,
+        //!                       the inputs are read and the outputs are written.
+        //!
+        //! \return ResultCode::Success or an error code.
+        ResultCode Run(UInt64 elementCount, ArraySlice<void* const> data);
+
+        //! \brief Get the grid elements processed per second by a device, measured by the previous runs.
+        //!
+        //! \param deviceIndex - Index of the device in DataParallelDispatcherDesc::Devices.
+        [[nodiscard]] inline Float64 GetThroughput(USize deviceIndex) const
+        {
+            return m_Devices[deviceIndex].Throughput;
+        }
+
+        //! \brief Split workgroups of a grid into contiguous parts proportionally to the weights.
+        //!
+        //! Uses the largest remainder method, so the parts always add up to the workgroup count.
+        //!
+        //! \param workgroupCount - Number of workgroups to split.
+        //! \param weights        - Non-negative weights of the parts, if all of them are zero, the grid is split evenly.
+        //! \param result         - Number of workgroups in each part, must have the same length as the weights.
+        inline static void SplitWorkgroups(UInt64 workgroupCount, ArraySlice<const Float64> weights, ArraySlice<UInt64> result)
+        {
+            UN_Assert(weights.Length() == result.Length(), "Weights and result must have the same length");
+            if (result.Empty())
+            {
+                return;
+            }
+
+            Float64 weightSum = 0;
+            for (auto weight : weights)
+            {
+                UN_Assert(weight >= 0, "Weights must be non-negative");
+                weightSum += weight;
+            }
+
+            std::vector<Float64> remainders(result.Length());
+            UInt64 assigned = 0;
+            for (USize i = 0; i < result.Length(); ++i)
+            {
+                auto share = weightSum > 0 ? workgroupCount * weights[i] / weightSum
+                                           : static_cast<Float64>(workgroupCount) / static_cast<Float64>(result.Length());
+                result[i]     = std::min(static_cast<UInt64>(share), workgroupCount - assigned);
+                remainders[i] = share - static_cast<Float64>(result[i]);
+                assigned += result[i];
+            }
+
+            for (; assigned < workgroupCount; ++assigned)
+            {
+                auto maxIndex = static_cast<USize>(std::max_element(remainders.begin(), remainders.end()) - remainders.begin());
+                ++result[maxIndex];
+                remainders[maxIndex] = -1;
+            }
+        }
+
+        inline static ResultCode Create(DataParallelDispatcher** ppDispatcher)
+        {
+            *ppDispatcher = AllocateObject<DataParallelDispatcher>();
+            (*ppDispatcher)->AddRef();
+            return ResultCode::Success;
+        }
+    };
+} // namespace UN
@@ -1,5 +1,5 @@
 #pragma once
-#include <UnCompute/Acceleration/AdapterInfo.h>
+#include <UnCompute/Acceleration/AdapterCapabilities.h>
 #include <UnCompute/Memory/Object.h>
 #include <UnCompute/Utils/DynamicLibrary.h>
 #include <UnCompute/Containers/ArraySlice.h>
@@ -14,13 +14,31 @@ namespace UN
                //! using Vulkan API compute shaders.
     };
 
+    //! \brief Debugging and validation profile of a device factory.
+    //!
+    //! Validation adds a significant CPU overhead to every backend call, so it should be disabled in production.
+    enum class DeviceFactoryProfile
+    {
+        Production,               //!< No validation and debug callbacks, object debug names are not passed to the backend.
+        Debug,                    //!< Standard validation with messages written to the log, object debug names are set.
+        GpuAssistedValidation,    //!< Debug profile plus validation of out-of-bounds accesses inside of kernels.
+        SynchronizationValidation //!< Debug profile plus validation of missing memory barriers and other hazards.
+    };
+
+    //! \brief The profile used when DeviceFactoryDesc::Profile is not specified, Debug in debug builds.
+    inline constexpr DeviceFactoryProfile DefaultDeviceFactoryProfile =
+        ValidationEnabled ? DeviceFactoryProfile::Debug : DeviceFactoryProfile::Production;
+
     //! \brief IDeviceFactory descriptor.
     struct DeviceFactoryDesc
     {
-        const char* ApplicationName; //!< Name of the application.
+        const char* ApplicationName;  //!< Name of the application.
+        DeviceFactoryProfile Profile; //!< Debugging and validation profile.
 
-        inline explicit DeviceFactoryDesc(const char* applicationName)
+        inline explicit DeviceFactoryDesc(const char* applicationName,
+                                          DeviceFactoryProfile profile = DefaultDeviceFactoryProfile)
             : ApplicationName(applicationName)
+            , Profile(profile)
         {
         }
     };
@@ -49,6 +67,14 @@ namespace UN
         //! \brief Get all adapters supported by the specified backend.
         [[nodiscard]] virtual ArraySlice<const AdapterInfo> EnumerateAdapters() = 0;
 
+        //! \brief Get capabilities and limits of an adapter.
+        //!
+        //! \param adapterId     - ID of the adapter, see AdapterInfo::Id.
+        //! \param pCapabilities - A pointer to memory where the capabilities will be written.
+        //!
+        //! \return ResultCode::Success or an error code.
+        virtual ResultCode GetAdapterCapabilities(UInt32 adapterId, AdapterCapabilities* pCapabilities) = 0;
+
         //! \brief Create a compute device.
         //!
         //! \param ppDevice - A pointer to memory where the pointer to the created device will be written.
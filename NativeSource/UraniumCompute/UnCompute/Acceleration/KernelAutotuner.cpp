@@ -0,0 +1,245 @@
+#include <UnCompute/Acceleration/KernelAutotuner.h>
+#include <UnCompute/Backend/IFence.h>
+#include <UnCompute/Utils/Sha256.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace UN
+{
+    ResultCode KernelAutotuner::Init(const KernelAutotunerDesc& desc)
+    {
+        if (desc.pDevice == nullptr || desc.pCompiler == nullptr)
+        {
+            UN_Error(false, "KernelAutotunerDesc::pDevice and KernelAutotunerDesc::pCompiler must not be null");
+            return ResultCode::InvalidArguments;
+        }
+
+        m_Name      = desc.Name ? desc.Name : "Kernel autotuner";
+        m_pDevice   = desc.pDevice;
+        m_pCompiler = desc.pCompiler;
+
+        UN_VerifyResult(m_pDevice->CreateCommandList(&m_pCommandList), "Couldn't create command list");
+        auto commandListDesc = CommandListDesc(m_Name.c_str(), HardwareQueueKindFlags::Compute, CommandListFlags::None, 2);
+        if (auto result = m_pCommandList->Init(commandListDesc); Failed(result))
+        {
+            return result;
+        }
+
+        UN_VerifyResultFatal(KernelCompilationCache::Create(&m_pCache), "Couldn't create KernelCompilationCache object");
+        return m_pCache->Init(KernelCompilationCacheDesc(desc.CacheDirectory, 256));
+    }
+
+    std::string KernelAutotuner::ComputeKey(const KernelCompilerDesc& compilerDesc, const KernelAutotunerArgs& args,
+                                            const AdapterInfo& adapter)
+    {
+        Sha256 hash;
+        hash.Update(KernelCompilationCache::ComputeKey(compilerDesc, args.CompilerArgs, {}));
+        hash.UpdateValue(adapter.DeviceUuid);
+        hash.UpdateValue(static_cast<UInt64>(args.Candidates.Length()));
+        for (auto& candidate : args.Candidates)
+        {
+            hash.UpdateValue(candidate.X);
+            hash.UpdateValue(candidate.Y);
+            hash.UpdateValue(candidate.Z);
+        }
+
+        hash.UpdateValue(args.InvocationCountX);
+        hash.UpdateValue(args.InvocationCountY);
+        hash.UpdateValue(args.InvocationCountZ);
+        return Sha256::ToHex(hash.Finalize());
+    }
+
+    ResultCode KernelAutotuner::Compile(const KernelAutotunerArgs& args, ArraySlice<const WorkgroupSize> candidates,
+                                        HeapArray<Byte>* pResults, ResultCode* pResultCodes)
+    {
+        // The definitions must stay alive until the whole batch is compiled.
+        std::vector<std::array<std::string, 3>> sizeStrings(candidates.Length());
+        std::vector<std::vector<CompilerDefinition>> definitions(candidates.Length());
+        std::vector<KernelCompilerArgs> compilerArgs(candidates.Length(), args.CompilerArgs);
+        for (USize i = 0; i < candidates.Length(); ++i)
+        {
+            sizeStrings[i] = { std::to_string(candidates[i].X),
+                               std::to_string(candidates[i].Y),
+                               std::to_string(candidates[i].Z) };
+
+            auto& candidateDefinitions = definitions[i];
+            candidateDefinitions.assign(args.CompilerArgs.Definitions.begin(), args.CompilerArgs.Definitions.end());
+            candidateDefinitions.emplace_back("WORKGROUP_SIZE_X", sizeStrings[i][0].c_str());
+            candidateDefinitions.emplace_back("WORKGROUP_SIZE_Y", sizeStrings[i][1].c_str());
+            candidateDefinitions.emplace_back("WORKGROUP_SIZE_Z", sizeStrings[i][2].c_str());
+            compilerArgs[i].Definitions = candidateDefinitions;
+        }
+
+        return m_pCompiler->CompileBatch(compilerArgs, pResults, pResultCodes, nullptr);
+    }
+
+    ResultCode KernelAutotuner::Measure(const KernelAutotunerArgs& args, const WorkgroupSize& candidate,
+                                        ArraySlice<const Byte> bytecode, UInt64* pTime)
+    {
+        Ptr<IKernel> pKernel;
+        UN_VerifyResult(m_pDevice->CreateKernel(&pKernel), "Couldn't create kernel");
+        if (auto result = pKernel->Init(KernelDesc(m_Name.c_str(), args.pResourceBinding, bytecode)); Failed(result))
+        {
+            return result;
+        }
+
+        if (pKernel->GetWorkgroupSize() != candidate)
+        {
+            UN_Error(false, "The kernel must declare [numthreads(WORKGROUP_SIZE_X, WORKGROUP_SIZE_Y, WORKGROUP_SIZE_Z)]");
+            return ResultCode::InvalidArguments;
+        }
+
+        auto& maxGroupCount = m_pDevice->GetAdapterInfo().MaxWorkgroupCount;
+        auto groupCountX    = candidate.GetGroupCountX(args.InvocationCountX);
+        auto groupCountY    = candidate.GetGroupCountY(args.InvocationCountY);
+        auto groupCountZ    = candidate.GetGroupCountZ(args.InvocationCountZ);
+        // The counts must fit both the device limits and the Int32 arguments of Dispatch().
+        auto fits = [](UInt64 groupCount, UInt32 limit) {
+            return groupCount <= std::min<UInt64>(limit, std::numeric_limits<Int32>::max());
+        };
+
+        if (!fits(groupCountX, maxGroupCount[0]) || !fits(groupCountY, maxGroupCount[1]) || !fits(groupCountZ, maxGroupCount[2]))
+        {
+            UN_Error(false,
+                     "Too many workgroups for a single dispatch: {}x{}x{}, the limit is {}x{}x{}",
+                     groupCountX,
+                     groupCountY,
+                     groupCountZ,
+                     maxGroupCount[0],
+                     maxGroupCount[1],
+                     maxGroupCount[2]);
+            return ResultCode::InvalidArguments;
+        }
+
+        if (m_pCommandList->GetState() != CommandListState::Initial)
+        {
+            m_pCommandList->ResetState();
+        }
+
+        auto builder = m_pCommandList->Begin();
+        if (!builder)
+        {
+            return ResultCode::InvalidOperation;
+        }
+
+        auto dispatch = [&]() {
+            builder.Dispatch(pKernel.Get(),
+                             static_cast<Int32>(groupCountX),
+                             static_cast<Int32>(groupCountY),
+                             static_cast<Int32>(groupCountZ));
+        };
+
+        for (UInt32 i = 0; i < args.WarmupIterations; ++i)
+        {
+            dispatch();
+        }
+
+        builder.WriteTimestamp(0);
+        for (UInt32 i = 0; i < args.TimedIterations; ++i)
+        {
+            dispatch();
+        }
+
+        builder.WriteTimestamp(1);
+        builder.End();
+
+        if (auto result = m_pCommandList->Submit(); Failed(result))
+        {
+            return result;
+        }
+        if (auto result = m_pCommandList->GetFence()->WaitOnCpu(); Failed(result))
+        {
+            return result;
+        }
+
+        UInt64 timestamps[2];
+        if (auto result = m_pCommandList->GetTimestamps(timestamps); Failed(result))
+        {
+            return result;
+        }
+
+        *pTime = (timestamps[1] - timestamps[0]) / args.TimedIterations;
+        return ResultCode::Success;
+    }
+
+    ResultCode KernelAutotuner::Tune(const KernelAutotunerArgs& args, KernelAutotunerResult* pResult)
+    {
+        if (args.Candidates.Empty() || args.pResourceBinding == nullptr || args.TimedIterations == 0)
+        {
+            UN_Error(false, "Tuning requires at least one candidate, a resource binding and one timed iteration");
+            return ResultCode::InvalidArguments;
+        }
+
+        auto key = ComputeKey(m_pCompiler->GetDesc(), args, m_pDevice->GetAdapterInfo());
+
+        // The winner is stored as three 32-bit integers in place of the bytecode.
+        UInt32 size[3];
+        HeapArray<Byte> cachedSize;
+        if (m_pCache->TryGet(key, &cachedSize) && cachedSize.Length() == sizeof(size))
+        {
+            memcpy(size, cachedSize.Data(), sizeof(size));
+            pResult->BestSize = WorkgroupSize(size[0], size[1], size[2]);
+            pResult->BestTime = 0;
+
+            ResultCode resultCode;
+            auto best = ArraySlice<const WorkgroupSize>(&pResult->BestSize, 1);
+            if (auto result = Compile(args, best, &pResult->Bytecode, &resultCode); Failed(result))
+            {
+                return result;
+            }
+
+            return resultCode;
+        }
+
+        HeapArray<HeapArray<Byte>> bytecodes(args.Candidates.Length());
+        HeapArray<ResultCode> resultCodes(args.Candidates.Length());
+        auto compileResult = Compile(args, args.Candidates, bytecodes.Data(), resultCodes.Data());
+
+        USize bestIndex = args.Candidates.Length();
+        UInt64 bestTime = std::numeric_limits<UInt64>::max();
+        for (USize i = 0; i < args.Candidates.Length(); ++i)
+        {
+            auto& candidate = args.Candidates[i];
+            if (Failed(resultCodes[i]))
+            {
+                UN_Warning(false, "Skipping workgroup size {}x{}x{}, it failed to compile", candidate.X, candidate.Y,
+                           candidate.Z);
+                continue;
+            }
+
+            UInt64 time;
+            if (auto result = Measure(args, candidate, bytecodes[i], &time); Failed(result))
+            {
+                return result;
+            }
+
+            UNLOG_Debug("Workgroup size {}x{}x{}: {} ns per dispatch", candidate.X, candidate.Y, candidate.Z, time);
+            if (time < bestTime)
+            {
+                bestIndex = i;
+                bestTime  = time;
+            }
+        }
+
+        if (bestIndex == args.Candidates.Length())
+        {
+            UN_Error(false, "None of the {} workgroup size candidates could be compiled", args.Candidates.Length());
+            return compileResult;
+        }
+
+        pResult->BestSize = args.Candidates[bestIndex];
+        pResult->BestTime = bestTime;
+        pResult->Bytecode = std::move(bytecodes[bestIndex]);
+
+        size[0] = pResult->BestSize.X;
+        size[1] = pResult->BestSize.Y;
+        size[2] = pResult->BestSize.Z;
+
+        auto* pSizeBytes = reinterpret_cast<const Byte*>(size);
+        m_pCache->Put(key, ArraySlice(pSizeBytes, pSizeBytes + sizeof(size)));
+        return ResultCode::Success;
+    }
+} // namespace UN
@@ -0,0 +1,131 @@
+#pragma once
+#include <UnCompute/Backend/ICommandList.h>
+#include <UnCompute/Backend/IComputeDevice.h>
+#include <UnCompute/Backend/IKernel.h>
+#include <UnCompute/Backend/IResourceBinding.h>
+#include <UnCompute/Compilation/IKernelCompiler.h>
+#include <UnCompute/Compilation/KernelCompilationCache.h>
+#include <UnCompute/Memory/Memory.h>
+#include <UnCompute/Memory/Ptr.h>
+#include <string>
+
+namespace UN
+{
+    //! \brief Kernel autotuner descriptor.
+    struct KernelAutotunerDesc
+    {
+        const char* Name           = nullptr; //!< Autotuner debug name, used for the created device objects.
+        IComputeDevice* pDevice    = nullptr; //!< Device to tune the kernels for.
+        IKernelCompiler* pCompiler = nullptr; //!< Compiler used to specialize the kernels for every candidate.
+
+        //! \brief Directory where the tuned workgroup sizes are stored, null to keep them in memory only.
+        const char* CacheDirectory = nullptr;
+
+        inline KernelAutotunerDesc() = default;
+
+        inline KernelAutotunerDesc(const char* name, IComputeDevice* pDevice, IKernelCompiler* pCompiler,
+                                   const char* cacheDirectory = nullptr)
+            : Name(name)
+            , pDevice(pDevice)
+            , pCompiler(pCompiler)
+            , CacheDirectory(cacheDirectory)
+        {
+        }
+    };
+
+    //! \brief Arguments that define a single tuning.
+    struct KernelAutotunerArgs
+    {
+        //! \brief Arguments used to compile the kernel.
+        //!
+        //! The kernel must declare `[numthreads(WORKGROUP_SIZE_X, WORKGROUP_SIZE_Y, WORKGROUP_SIZE_Z)]`, the definitions
+        //! are added by the autotuner for every candidate.
+        KernelCompilerArgs CompilerArgs;
+
+        //! \brief Workgroup sizes to try, must not exceed AdapterCapabilities::MaxWorkgroupSize and
+        //!        AdapterCapabilities::MaxWorkgroupInvocations.
+        ArraySlice<const WorkgroupSize> Candidates;
+
+        //! \brief Resources with representative input, bound to the kernel of every candidate.
+        //!
+        //! The kernel runs multiple times on the same resources, so it must not depend on its own previous output.
+        IResourceBinding* pResourceBinding = nullptr;
+
+        UInt64 InvocationCountX = 1; //!< Number of invocations along the X axis the kernel is dispatched for.
+        UInt64 InvocationCountY = 1; //!< Number of invocations along the Y axis the kernel is dispatched for.
+        UInt64 InvocationCountZ = 1; //!< Number of invocations along the Z axis the kernel is dispatched for.
+
+        UInt32 WarmupIterations = 2;  //!< Number of dispatches of every candidate before the timing starts.
+        UInt32 TimedIterations  = 10; //!< Number of timed dispatches of every candidate.
+    };
+
+    //! \brief Result of a tuning.
+    struct KernelAutotunerResult
+    {
+        WorkgroupSize BestSize;   //!< The fastest of the candidates.
+        HeapArray<Byte> Bytecode; //!< Kernel bytecode specialized for the fastest candidate.
+
+        //! \brief Average device time of a dispatch with the best size in nanoseconds, zero if the result was cached.
+        UInt64 BestTime = 0;
+    };
+
+    //! \brief Chooses the fastest workgroup size of a kernel by running it on the device.
+    //!
+    //! The kernel is compiled for every candidate workgroup size, each candidate is dispatched with the same resources
+    //! and timed with GPU timestamps. The winner is stored by a key of the kernel, the candidates, the dispatch size
+    //! and the UUID of the adapter, see ComputeKey(). Later tunings of the same kernel on the same adapter only compile
+    //! the winner, also in other processes if a cache directory is specified.
+    //!
+    //! The adapter must support timestamps, see AdapterCapabilities::TimestampPeriod.
+    class KernelAutotuner final : public Object<IObject>
+    {
+        std::string m_Name;
+        Ptr<IComputeDevice> m_pDevice;
+        Ptr<IKernelCompiler> m_pCompiler;
+        Ptr<ICommandList> m_pCommandList;
+        Ptr<KernelCompilationCache> m_pCache;
+
+        ResultCode Compile(const KernelAutotunerArgs& args, ArraySlice<const WorkgroupSize> candidates,
+                           HeapArray<Byte>* pResults, ResultCode* pResultCodes);
+        ResultCode Measure(const KernelAutotunerArgs& args, const WorkgroupSize& candidate, ArraySlice<const Byte> bytecode,
+                           UInt64* pTime);
+
+    public:
+        inline KernelAutotuner() = default;
+        ~KernelAutotuner() override = default;
+
+        //! \brief Create the command list used for timing and the storage of tuned workgroup sizes.
+        //!
+        //! \param desc - Autotuner descriptor.
+        //!
+        //! \return ResultCode::Success or an error code.
+        ResultCode Init(const KernelAutotunerDesc& desc);
+
+        //! \brief Find the fastest workgroup size of a kernel, or get it from the previous tunings.
+        //!
+        //! Candidates that fail to compile are skipped.
+        //!
+        //! \param args    - Tuning arguments.
+        //! \param pResult - A pointer to a structure where the result will be written.
+        //!
+        //! \return ResultCode::Success or an error code.
+        ResultCode Tune(const KernelAutotunerArgs& args, KernelAutotunerResult* pResult);
+
+        //! \brief Compute the key a tuned workgroup size is stored by.
+        //!
+        //! \param compilerDesc - Descriptor of the compiler that compiles the kernel.
+        //! \param args         - Tuning arguments.
+        //! \param adapter      - The adapter the kernel is tuned for, only its UUID is used.
+        //!
+        //! \return A hexadecimal SHA-256 hash of the inputs.
+        static std::string ComputeKey(const KernelCompilerDesc& compilerDesc, const KernelAutotunerArgs& args,
+                                      const AdapterInfo& adapter);
+
+        inline static ResultCode Create(KernelAutotuner** ppAutotuner)
+        {
+            *ppAutotuner = AllocateObject<KernelAutotuner>();
+            (*ppAutotuner)->AddRef();
+            return ResultCode::Success;
+        }
+    };
+} // namespace UN
@@ -21,4 +21,46 @@ namespace UN
     };
 
     UN_ENUM_OPERATORS(HardwareQueueKindFlags);
+
+    //! \brief Optional device features that kernels can use.
+    //!
+    //! Supported features are reported in AdapterInfo::SupportedFeatures, the required ones must be enabled
+    //! on device creation via ComputeDeviceDesc::RequiredFeatures.
+    enum class DeviceFeatureFlags
+    {
+        None = 0, //!< No optional features.
+
+        Float16      = UN_BIT(0), //!< 16-bit floating point arithmetic (float16_t, half).
+        Float64      = UN_BIT(1), //!< 64-bit floating point arithmetic (double).
+        Int8         = UN_BIT(2), //!< 8-bit integer arithmetic.
+        Int16        = UN_BIT(3), //!< 16-bit integer arithmetic (int16_t, uint16_t).
+        Int64        = UN_BIT(4), //!< 64-bit integer arithmetic (int64_t, uint64_t).
+        Storage16Bit = UN_BIT(5), //!< 16-bit types in storage and uniform buffers.
+        Storage8Bit  = UN_BIT(6), //!< 8-bit types in storage and uniform buffers.
+        Int64Atomics = UN_BIT(7)  //!< 64-bit atomic operations on buffers (InterlockedAdd on uint64_t, etc.).
+    };
+
+    UN_ENUM_OPERATORS(DeviceFeatureFlags);
+
+    //! \brief Environment that compiled kernels target, defines the SPIR-V version and the core capabilities available.
+    //!
+    //! The newest environment supported by an adapter is reported in AdapterInfo::TargetEnv.
+    enum class KernelTargetEnv
+    {
+        Vulkan1_1, //!< Vulkan 1.1, SPIR-V 1.3.
+        Vulkan1_2, //!< Vulkan 1.2, SPIR-V 1.5.
+        Vulkan1_3  //!< Vulkan 1.3, SPIR-V 1.6.
+    };
+
+    //! \brief HLSL shader model that compiled kernels use, defines the available intrinsics.
+    enum class KernelShaderModel
+    {
+        SM6_0, //!< Wave intrinsics.
+        SM6_1, //!< SV_ViewID and barycentrics, no new compute intrinsics.
+        SM6_2, //!< Native 16-bit types.
+        SM6_3, //!< Ray tracing, no new compute intrinsics.
+        SM6_4, //!< Packed 8-bit dot products (dot4add_u8packed, etc.).
+        SM6_5, //!< WaveMatch and WaveMultiPrefix intrinsics.
+        SM6_6  //!< 64-bit atomics, packed 8-bit types and WaveSize attribute.
+    };
 } // namespace UN
@@ -18,6 +18,8 @@ namespace UN
         }
 
         m_State = CommandListState::Recording;
+        m_CommandStream.Clear();
+        m_RecordingResult = ResultCode::Success;
         if (auto resultCode = BeginInternal(); Failed(resultCode))
         {
             UN_Assert(false, "Couldn't begin the command list, result was {}", resultCode);
@@ -47,10 +49,45 @@ namespace UN
             return ResultCode::InvalidOperation;
         }
 
+        if (Failed(m_RecordingResult))
+        {
+            UN_Error(false, "Command list \"{}\" can't be submitted, an invalid command was recorded", GetDebugName());
+            return m_RecordingResult;
+        }
+
         m_State = CommandListState::Pending;
         return SubmitInternal();
     }
 
+    ResultCode CommandListBase::Submit(CommandListCompletionCallback callback, void* pUserData)
+    {
+        UN_Assert(callback, "Completion callback must not be null");
+        if (auto result = Submit(); Failed(result))
+        {
+            return result;
+        }
+
+        return WatchCompletionInternal(callback, pUserData);
+    }
+
+    ResultCode CommandListBase::GetTimestamps(ArraySlice<UInt64> timestamps)
+    {
+        if (timestamps.Length() > m_Desc.TimestampQueryCount)
+        {
+            UN_Error(false, "Requested {} timestamps, but the command list only has {} timestamp queries", timestamps.Length(),
+                     m_Desc.TimestampQueryCount);
+            return ResultCode::InvalidArguments;
+        }
+
+        if (auto state = GetState(); state == CommandListState::Pending)
+        {
+            UN_Error(false, "Timestamps can't be read while the command list is in {}", state);
+            return ResultCode::InvalidOperation;
+        }
+
+        return GetTimestampsInternal(timestamps);
+    }
+
     void CommandListBase::End()
     {
         if (auto state = GetState(); state != CommandListState::Recording)
@@ -65,6 +102,71 @@ namespace UN
         }
     }
 
+    void CommandListBase::CmdMemoryBarrier(IBuffer* pBuffer, const MemoryBarrierDesc& barrierDesc)
+    {
+        m_CommandStream.MemoryBarrier(pBuffer, barrierDesc);
+    }
+
+    void CommandListBase::CmdMemoryBarrier(IImage* pImage, const MemoryBarrierDesc& barrierDesc)
+    {
+        m_CommandStream.MemoryBarrier(pImage, barrierDesc);
+    }
+
+    void CommandListBase::CmdCopy(IBuffer* pSource, IBuffer* pDestination, ArraySlice<const BufferCopyRegion> regions)
+    {
+        m_CommandStream.Copy(pSource, pDestination, regions);
+    }
+
+    void CommandListBase::CmdCopy(IBuffer* pSource, IImage* pDestination, const BufferImageCopyRegion& region)
+    {
+        m_CommandStream.Copy(pSource, pDestination, region);
+    }
+
+    void CommandListBase::CmdCopy(IImage* pSource, IBuffer* pDestination, const BufferImageCopyRegion& region)
+    {
+        m_CommandStream.Copy(pSource, pDestination, region);
+    }
+
+    void CommandListBase::CmdFill(IBuffer* pBuffer, UInt64 offset, UInt64 size, UInt32 value)
+    {
+        m_CommandStream.Fill(pBuffer, offset, size, value);
+    }
+
+    void CommandListBase::CmdUpdate(IBuffer* pBuffer, UInt64 offset, const void* pData, UInt64 size)
+    {
+        m_CommandStream.Update(pBuffer, offset, pData, size);
+    }
+
+    void CommandListBase::CmdDispatch(IKernel* pKernel, Int32 x, Int32 y, Int32 z)
+    {
+        auto& maxGroupCount = m_pDevice->GetAdapterInfo().MaxWorkgroupCount;
+        if (DispatchCommand{ pKernel, x, y, z }.Exceeds(maxGroupCount))
+        {
+            UN_Error(false,
+                     "Dispatch of {}x{}x{} workgroups exceeds the device limit of {}x{}x{}",
+                     x,
+                     y,
+                     z,
+                     maxGroupCount[0],
+                     maxGroupCount[1],
+                     maxGroupCount[2]);
+            m_RecordingResult = ResultCode::InvalidArguments;
+            return;
+        }
+
+        m_CommandStream.Dispatch(pKernel, x, y, z);
+    }
+
+    void CommandListBase::CmdDispatchIndirect(IKernel* pKernel, IBuffer* pArgsBuffer, UInt64 offset)
+    {
+        m_CommandStream.DispatchIndirect(pKernel, pArgsBuffer, offset);
+    }
+
+    void CommandListBase::CmdWriteTimestamp(UInt32 index)
+    {
+        m_CommandStream.WriteTimestamp(index);
+    }
+
     IFence* CommandListBase::GetFence()
     {
         return m_pFence.Get();
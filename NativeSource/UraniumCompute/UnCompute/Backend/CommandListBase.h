@@ -1,4 +1,5 @@
 #pragma once
+#include <UnCompute/Backend/CommandStream.h>
 #include <UnCompute/Backend/DeviceObjectBase.h>
 #include <UnCompute/Backend/ICommandList.h>
 #include <UnCompute/Backend/IFence.h>
@@ -11,14 +12,37 @@ namespace UN
         CommandListState m_State = CommandListState::Invalid;
         Ptr<IFence> m_pFence;
 
+        //! \brief Commands recorded since Begin(), the backend must translate them in EndInternal().
+        CommandStream m_CommandStream;
+
+        //! \brief An error in the commands recorded since Begin(), returned by the following Submit().
+        ResultCode m_RecordingResult = ResultCode::Success;
+
         virtual ResultCode InitInternal(const CommandListDesc& desc) = 0;
         virtual ResultCode BeginInternal()                           = 0;
         virtual ResultCode EndInternal()                             = 0;
         virtual ResultCode ResetStateInternal()                      = 0;
         virtual ResultCode SubmitInternal()                          = 0;
 
+        //! \brief Called after a successful submission to report completion of the command list to the callback.
+        virtual ResultCode WatchCompletionInternal(CommandListCompletionCallback callback, void* pUserData) = 0;
+
+        //! \brief Called by GetTimestamps() after the arguments and the state are validated.
+        virtual ResultCode GetTimestampsInternal(ArraySlice<UInt64> timestamps) = 0;
+
         void End() override;
 
+        void CmdMemoryBarrier(IBuffer* pBuffer, const MemoryBarrierDesc& barrierDesc) final;
+        void CmdMemoryBarrier(IImage* pImage, const MemoryBarrierDesc& barrierDesc) final;
+        void CmdCopy(IBuffer* pSource, IBuffer* pDestination, ArraySlice<const BufferCopyRegion> regions) final;
+        void CmdCopy(IBuffer* pSource, IImage* pDestination, const BufferImageCopyRegion& region) final;
+        void CmdCopy(IImage* pSource, IBuffer* pDestination, const BufferImageCopyRegion& region) final;
+        void CmdFill(IBuffer* pBuffer, UInt64 offset, UInt64 size, UInt32 value) final;
+        void CmdUpdate(IBuffer* pBuffer, UInt64 offset, const void* pData, UInt64 size) final;
+        void CmdDispatch(IKernel* pKernel, Int32 x, Int32 y, Int32 z) final;
+        void CmdDispatchIndirect(IKernel* pKernel, IBuffer* pArgsBuffer, UInt64 offset) final;
+        void CmdWriteTimestamp(UInt32 index) final;
+
         inline explicit CommandListBase(IComputeDevice* pDevice)
             : DeviceObjectBase(pDevice)
         {
@@ -32,5 +56,7 @@ namespace UN
         CommandListBuilder Begin() override;
         void ResetState() override;
         ResultCode Submit() override;
+        ResultCode Submit(CommandListCompletionCallback callback, void* pUserData) override;
+        ResultCode GetTimestamps(ArraySlice<UInt64> timestamps) override;
     };
 } // namespace UN
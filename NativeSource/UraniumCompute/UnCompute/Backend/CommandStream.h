@@ -0,0 +1,406 @@
+#pragma once
+#include <UnCompute/Backend/ICommandList.h>
+#include <UnCompute/Base/Byte.h>
+#include <UnCompute/Containers/ArraySlice.h>
+#include <cstring>
+#include <new>
+#include <vector>
+
+namespace UN
+{
+    //! \brief Type of command recorded to a CommandStream.
+    enum class CommandType : UInt32
+    {
+        MemoryBarrier,     //!< A batch of memory barriers, see MemoryBarrierCommand.
+        CopyBuffer,        //!< Buffer to buffer copy, see CopyBufferCommand.
+        CopyBufferToImage, //!< Buffer to image copy, see CopyBufferToImageCommand.
+        CopyImageToBuffer, //!< Image to buffer copy, see CopyImageToBufferCommand.
+        Fill,              //!< Buffer fill, see FillCommand.
+        Update,            //!< Buffer update, see UpdateCommand.
+        Dispatch,          //!< Kernel dispatch, see DispatchCommand.
+        DispatchIndirect,  //!< Indirect kernel dispatch, see DispatchIndirectCommand.
+        WriteTimestamp     //!< Timestamp query write, see WriteTimestampCommand.
+    };
+
+    //! \brief Memory barrier for a single buffer or image, stored in MemoryBarrierCommand.
+    struct ResourceBarrier
+    {
+        IBuffer* pBuffer = nullptr; //!< The buffer to insert the barrier for, null if the barrier is for an image.
+        IImage* pImage   = nullptr; //!< The image to insert the barrier for, null if the barrier is for a buffer.
+        MemoryBarrierDesc Desc;     //!< Barrier access masks and queue kinds.
+    };
+
+    //! \brief A batch of consecutive memory barriers, followed by BarrierCount ResourceBarrier structures.
+    struct alignas(8) MemoryBarrierCommand
+    {
+        inline static constexpr CommandType Type = CommandType::MemoryBarrier;
+
+        UInt32 BarrierCount = 0;
+
+        [[nodiscard]] inline ArraySlice<const ResourceBarrier> GetBarriers() const
+        {
+            auto* pBegin = reinterpret_cast<const ResourceBarrier*>(this + 1);
+            return ArraySlice<const ResourceBarrier>(pBegin, pBegin + BarrierCount);
+        }
+    };
+
+    //! \brief Buffer to buffer copy, followed by RegionCount BufferCopyRegion structures.
+    struct alignas(8) CopyBufferCommand
+    {
+        inline static constexpr CommandType Type = CommandType::CopyBuffer;
+
+        IBuffer* pSource      = nullptr;
+        IBuffer* pDestination = nullptr;
+        UInt32 RegionCount    = 0;
+
+        [[nodiscard]] inline ArraySlice<const BufferCopyRegion> GetRegions() const
+        {
+            auto* pBegin = reinterpret_cast<const BufferCopyRegion*>(this + 1);
+            return ArraySlice<const BufferCopyRegion>(pBegin, pBegin + RegionCount);
+        }
+    };
+
+    //! \brief Buffer to image copy.
+    struct CopyBufferToImageCommand
+    {
+        inline static constexpr CommandType Type = CommandType::CopyBufferToImage;
+
+        IBuffer* pSource     = nullptr;
+        IImage* pDestination = nullptr;
+        BufferImageCopyRegion Region;
+    };
+
+    //! \brief Image to buffer copy.
+    struct CopyImageToBufferCommand
+    {
+        inline static constexpr CommandType Type = CommandType::CopyImageToBuffer;
+
+        IImage* pSource       = nullptr;
+        IBuffer* pDestination = nullptr;
+        BufferImageCopyRegion Region;
+    };
+
+    //! \brief Buffer fill.
+    struct FillCommand
+    {
+        inline static constexpr CommandType Type = CommandType::Fill;
+
+        IBuffer* pBuffer = nullptr;
+        UInt64 Offset    = 0;
+        UInt64 Size      = 0;
+        UInt32 Value     = 0;
+    };
+
+    //! \brief Buffer update, followed by Size bytes of data copied at record time.
+    struct alignas(8) UpdateCommand
+    {
+        inline static constexpr CommandType Type = CommandType::Update;
+
+        IBuffer* pBuffer = nullptr;
+        UInt64 Offset    = 0;
+        UInt64 Size      = 0;
+
+        [[nodiscard]] inline const void* GetData() const
+        {
+            return this + 1;
+        }
+    };
+
+    //! \brief Kernel dispatch.
+    struct DispatchCommand
+    {
+        inline static constexpr CommandType Type = CommandType::Dispatch;
+
+        IKernel* pKernel = nullptr;
+        Int32 X          = 1;
+        Int32 Y          = 1;
+        Int32 Z          = 1;
+
+        //! \brief Check if the dispatch exceeds the maximum number of workgroups along any dimension.
+        //!
+        //! \param maxGroupCount - Maximum number of workgroups in a single dispatch along each dimension.
+        [[nodiscard]] inline bool Exceeds(const UInt32 (&maxGroupCount)[3]) const
+        {
+            return static_cast<UInt32>(X) > maxGroupCount[0] || static_cast<UInt32>(Y) > maxGroupCount[1]
+                || static_cast<UInt32>(Z) > maxGroupCount[2];
+        }
+    };
+
+    //! \brief Indirect kernel dispatch.
+    struct DispatchIndirectCommand
+    {
+        inline static constexpr CommandType Type = CommandType::DispatchIndirect;
+
+        IKernel* pKernel     = nullptr;
+        IBuffer* pArgsBuffer = nullptr;
+        UInt64 Offset        = 0;
+    };
+
+    //! \brief Timestamp query write.
+    struct alignas(8) WriteTimestampCommand
+    {
+        inline static constexpr CommandType Type = CommandType::WriteTimestamp;
+
+        UInt32 Index = 0;
+    };
+
+    //! \brief Header of every command in a CommandStream, immediately followed by the command structure.
+    struct CommandHeader
+    {
+        CommandType Type = CommandType::MemoryBarrier; //!< Type of the command that follows the header.
+        UInt32 Size      = 0;                          //!< Size of the command in bytes, including the header.
+
+        //! \brief Get the command that follows the header, T::Type must match the type stored in the header.
+        template<class T>
+        [[nodiscard]] inline const T& Get() const
+        {
+            UN_Assert(T::Type == Type, "Command type mismatch");
+            return *reinterpret_cast<const T*>(this + 1);
+        }
+    };
+
+    //! \brief A compact linear stream of recorded commands.
+    //!
+    //! Commands are stored one after another in a single byte array together with their variable-length data, so
+    //! recording a command is an append without any calls into the backend. The backend translates the whole stream
+    //! in one pass when the command list is ended.
+    //!
+    //! Consecutive memory barriers are coalesced into a single MemoryBarrierCommand, barriers for the same resource
+    //! with the same queue kinds are merged into one. The stream doesn't hold references to the resources, they must
+    //! be kept alive until the command list is executed, as with immediate recording.
+    class CommandStream final
+    {
+        inline static constexpr USize CommandAlignment = 8;
+
+        static_assert(sizeof(CommandHeader) % CommandAlignment == 0);
+        static_assert(sizeof(ResourceBarrier) % CommandAlignment == 0);
+        static_assert(sizeof(BufferCopyRegion) % CommandAlignment == 0);
+
+        std::vector<Byte> m_Data;
+        USize m_LastCommandOffset = 0;
+        UInt32 m_CommandCount     = 0;
+
+        template<class T>
+        inline T* AllocateCommand(USize extraSize)
+        {
+            static_assert(alignof(T) <= CommandAlignment && sizeof(T) % CommandAlignment == 0);
+
+            auto offset = m_Data.size();
+            auto size   = AlignUp(sizeof(CommandHeader) + sizeof(T) + extraSize, CommandAlignment);
+            m_Data.resize(offset + size);
+
+            auto* pHeader = new (m_Data.data() + offset) CommandHeader{};
+            pHeader->Type = T::Type;
+            pHeader->Size = static_cast<UInt32>(size);
+
+            m_LastCommandOffset = offset;
+            ++m_CommandCount;
+            return new (pHeader + 1) T{};
+        }
+
+        //! \brief Get the last command if it is of type T.
+        template<class T>
+        inline T* GetLastCommand()
+        {
+            if (m_CommandCount == 0)
+            {
+                return nullptr;
+            }
+
+            auto* pHeader = reinterpret_cast<CommandHeader*>(m_Data.data() + m_LastCommandOffset);
+            return pHeader->Type == T::Type ? reinterpret_cast<T*>(pHeader + 1) : nullptr;
+        }
+
+        //! \brief Get the pointer to the variable-length data that is stored right after a command.
+        template<class TData, class TCommand>
+        inline static TData* GetTrailingData(TCommand* pCommand)
+        {
+            return reinterpret_cast<TData*>(pCommand + 1);
+        }
+
+        inline void AddBarrier(IBuffer* pBuffer, IImage* pImage, const MemoryBarrierDesc& barrierDesc)
+        {
+            if (auto* pCommand = GetLastCommand<MemoryBarrierCommand>())
+            {
+                auto* pBarriers = GetTrailingData<ResourceBarrier>(pCommand);
+                for (UInt32 i = 0; i < pCommand->BarrierCount; ++i)
+                {
+                    auto& barrier = pBarriers[i];
+                    if (barrier.pBuffer == pBuffer && barrier.pImage == pImage
+                        && barrier.Desc.SourceQueueKind == barrierDesc.SourceQueueKind
+                        && barrier.Desc.DestQueueKind == barrierDesc.DestQueueKind)
+                    {
+                        barrier.Desc.SourceAccess |= barrierDesc.SourceAccess;
+                        barrier.Desc.DestAccess |= barrierDesc.DestAccess;
+                        return;
+                    }
+                }
+
+                // The barrier command is the last one in the stream, so it can be extended in place.
+                auto commandOffset = m_LastCommandOffset;
+                m_Data.resize(m_Data.size() + sizeof(ResourceBarrier));
+
+                auto* pHeader = reinterpret_cast<CommandHeader*>(m_Data.data() + commandOffset);
+                pHeader->Size += static_cast<UInt32>(sizeof(ResourceBarrier));
+                pCommand  = reinterpret_cast<MemoryBarrierCommand*>(pHeader + 1);
+                pBarriers = GetTrailingData<ResourceBarrier>(pCommand);
+                new (&pBarriers[pCommand->BarrierCount++]) ResourceBarrier{ pBuffer, pImage, barrierDesc };
+                return;
+            }
+
+            auto* pCommand = AllocateCommand<MemoryBarrierCommand>(sizeof(ResourceBarrier));
+            new (GetTrailingData<ResourceBarrier>(pCommand)) ResourceBarrier{ pBuffer, pImage, barrierDesc };
+            pCommand->BarrierCount = 1;
+        }
+
+    public:
+        //! \brief Forward iterator over the commands in the stream.
+        class Iterator
+        {
+            const Byte* m_pCurrent;
+
+        public:
+            inline explicit Iterator(const Byte* pCurrent)
+                : m_pCurrent(pCurrent)
+            {
+            }
+
+            inline const CommandHeader& operator*() const
+            {
+                return *reinterpret_cast<const CommandHeader*>(m_pCurrent);
+            }
+
+            inline const CommandHeader* operator->() const
+            {
+                return reinterpret_cast<const CommandHeader*>(m_pCurrent);
+            }
+
+            inline Iterator& operator++()
+            {
+                m_pCurrent += (**this).Size;
+                return *this;
+            }
+
+            inline bool operator==(const Iterator& other) const
+            {
+                return m_pCurrent == other.m_pCurrent;
+            }
+
+            inline bool operator!=(const Iterator& other) const
+            {
+                return m_pCurrent != other.m_pCurrent;
+            }
+        };
+
+        //! \brief Remove all the commands, the allocated memory is kept for the next recording.
+        inline void Clear()
+        {
+            m_Data.clear();
+            m_LastCommandOffset = 0;
+            m_CommandCount      = 0;
+        }
+
+        //! \brief Get the number of commands in the stream, a batch of coalesced barriers is a single command.
+        [[nodiscard]] inline UInt32 GetCommandCount() const
+        {
+            return m_CommandCount;
+        }
+
+        //! \brief Get the size of the recorded commands in bytes.
+        [[nodiscard]] inline USize GetByteSize() const
+        {
+            return m_Data.size();
+        }
+
+        [[nodiscard]] inline Iterator begin() const
+        {
+            return Iterator(m_Data.data());
+        }
+
+        [[nodiscard]] inline Iterator end() const
+        {
+            return Iterator(m_Data.data() + m_Data.size());
+        }
+
+        inline void MemoryBarrier(IBuffer* pBuffer, const MemoryBarrierDesc& barrierDesc)
+        {
+            AddBarrier(pBuffer, nullptr, barrierDesc);
+        }
+
+        inline void MemoryBarrier(IImage* pImage, const MemoryBarrierDesc& barrierDesc)
+        {
+            AddBarrier(nullptr, pImage, barrierDesc);
+        }
+
+        inline void Copy(IBuffer* pSource, IBuffer* pDestination, ArraySlice<const BufferCopyRegion> regions)
+        {
+            auto* pCommand         = AllocateCommand<CopyBufferCommand>(regions.Length() * sizeof(BufferCopyRegion));
+            pCommand->pSource      = pSource;
+            pCommand->pDestination = pDestination;
+            pCommand->RegionCount  = static_cast<UInt32>(regions.Length());
+
+            auto* pRegions = GetTrailingData<BufferCopyRegion>(pCommand);
+            for (USize i = 0; i < regions.Length(); ++i)
+            {
+                new (&pRegions[i]) BufferCopyRegion(regions[i]);
+            }
+        }
+
+        inline void Copy(IBuffer* pSource, IImage* pDestination, const BufferImageCopyRegion& region)
+        {
+            auto* pCommand         = AllocateCommand<CopyBufferToImageCommand>(0);
+            pCommand->pSource      = pSource;
+            pCommand->pDestination = pDestination;
+            pCommand->Region       = region;
+        }
+
+        inline void Copy(IImage* pSource, IBuffer* pDestination, const BufferImageCopyRegion& region)
+        {
+            auto* pCommand         = AllocateCommand<CopyImageToBufferCommand>(0);
+            pCommand->pSource      = pSource;
+            pCommand->pDestination = pDestination;
+            pCommand->Region       = region;
+        }
+
+        inline void Fill(IBuffer* pBuffer, UInt64 offset, UInt64 size, UInt32 value)
+        {
+            auto* pCommand    = AllocateCommand<FillCommand>(0);
+            pCommand->pBuffer = pBuffer;
+            pCommand->Offset  = offset;
+            pCommand->Size    = size;
+            pCommand->Value   = value;
+        }
+
+        inline void Update(IBuffer* pBuffer, UInt64 offset, const void* pData, UInt64 size)
+        {
+            auto* pCommand    = AllocateCommand<UpdateCommand>(static_cast<USize>(size));
+            pCommand->pBuffer = pBuffer;
+            pCommand->Offset  = offset;
+            pCommand->Size    = size;
+            memcpy(GetTrailingData<Byte>(pCommand), pData, static_cast<USize>(size));
+        }
+
+        inline void Dispatch(IKernel* pKernel, Int32 x, Int32 y, Int32 z)
+        {
+            auto* pCommand    = AllocateCommand<DispatchCommand>(0);
+            pCommand->pKernel = pKernel;
+            pCommand->X       = x;
+            pCommand->Y       = y;
+            pCommand->Z       = z;
+        }
+
+        inline void DispatchIndirect(IKernel* pKernel, IBuffer* pArgsBuffer, UInt64 offset)
+        {
+            auto* pCommand        = AllocateCommand<DispatchIndirectCommand>(0);
+            pCommand->pKernel     = pKernel;
+            pCommand->pArgsBuffer = pArgsBuffer;
+            pCommand->Offset      = offset;
+        }
+
+        inline void WriteTimestamp(UInt32 index)
+        {
+            auto* pCommand  = AllocateCommand<WriteTimestampCommand>(0);
+            pCommand->Index = index;
+        }
+    };
+} // namespace UN
@@ -0,0 +1,105 @@
+#pragma once
+#include <UnCompute/Base/Base.h>
+
+namespace UN
+{
+    //! \brief Format of texels stored in typed buffers and images.
+    //!
+    //! The data is converted by the hardware when accessed by a kernel, e.g. R8_UNorm texels are read as floats
+    //! in range [0, 1].
+    enum class Format
+    {
+        None, //!< Invalid or unspecified format.
+
+        R8_UNorm,
+        R8_SNorm,
+        R8_UInt,
+        R8_SInt,
+        R8G8_UNorm,
+        R8G8_SNorm,
+        R8G8_UInt,
+        R8G8_SInt,
+        R8G8B8A8_UNorm,
+        R8G8B8A8_SNorm,
+        R8G8B8A8_UInt,
+        R8G8B8A8_SInt,
+
+        R16_UNorm,
+        R16_SNorm,
+        R16_UInt,
+        R16_SInt,
+        R16_SFloat,
+        R16G16_UNorm,
+        R16G16_SNorm,
+        R16G16_UInt,
+        R16G16_SInt,
+        R16G16_SFloat,
+        R16G16B16A16_UNorm,
+        R16G16B16A16_SNorm,
+        R16G16B16A16_UInt,
+        R16G16B16A16_SInt,
+        R16G16B16A16_SFloat,
+
+        R32_UInt,
+        R32_SInt,
+        R32_SFloat,
+        R32G32_UInt,
+        R32G32_SInt,
+        R32G32_SFloat,
+        R32G32B32A32_UInt,
+        R32G32B32A32_SInt,
+        R32G32B32A32_SFloat
+    };
+
+    //! \brief Get size of a single texel of the specified format in bytes.
+    inline UInt32 GetFormatSize(Format format)
+    {
+        switch (format)
+        {
+        case Format::R8_UNorm:
+        case Format::R8_SNorm:
+        case Format::R8_UInt:
+        case Format::R8_SInt:
+            return 1;
+        case Format::R8G8_UNorm:
+        case Format::R8G8_SNorm:
+        case Format::R8G8_UInt:
+        case Format::R8G8_SInt:
+        case Format::R16_UNorm:
+        case Format::R16_SNorm:
+        case Format::R16_UInt:
+        case Format::R16_SInt:
+        case Format::R16_SFloat:
+            return 2;
+        case Format::R8G8B8A8_UNorm:
+        case Format::R8G8B8A8_SNorm:
+        case Format::R8G8B8A8_UInt:
+        case Format::R8G8B8A8_SInt:
+        case Format::R16G16_UNorm:
+        case Format::R16G16_SNorm:
+        case Format::R16G16_UInt:
+        case Format::R16G16_SInt:
+        case Format::R16G16_SFloat:
+        case Format::R32_UInt:
+        case Format::R32_SInt:
+        case Format::R32_SFloat:
+            return 4;
+        case Format::R16G16B16A16_UNorm:
+        case Format::R16G16B16A16_SNorm:
+        case Format::R16G16B16A16_UInt:
+        case Format::R16G16B16A16_SInt:
+        case Format::R16G16B16A16_SFloat:
+        case Format::R32G32_UInt:
+        case Format::R32G32_SInt:
+        case Format::R32G32_SFloat:
+            return 8;
+        case Format::R32G32B32A32_UInt:
+        case Format::R32G32B32A32_SInt:
+        case Format::R32G32B32A32_SFloat:
+            return 16;
+        case Format::None:
+        default:
+            return 0;
+        }
+    }
+} // namespace UN
@@ -6,8 +6,9 @@ namespace UN
     //! \brief Buffer usage type.
     enum class BufferUsage
     {
-        Storage, //!< The buffer is used as a storage for an array of elements.
-        Constant //!< The buffer is used to store kernel constants.
+        Storage,  //!< The buffer is used as a storage for an array of elements.
+        Constant, //!< The buffer is used to store kernel constants.
+        Indirect  //!< The buffer is used as a storage and to store indirect dispatch arguments.
     };
 
     //! \brief Buffer descriptor.
@@ -1,6 +1,7 @@
 #pragma once
 #include <UnCompute/Backend/BaseTypes.h>
 #include <UnCompute/Backend/IDeviceObject.h>
+#include <UnCompute/Containers/ArraySlice.h>
 #include <UnCompute/Memory/Ptr.h>
 
 namespace UN
@@ -49,13 +50,19 @@ namespace UN
         HardwareQueueKindFlags QueueKindFlags = HardwareQueueKindFlags::Compute; //!< Command queue kind flags.
         CommandListFlags Flags                = CommandListFlags::None;          //!< Command list flags.
 
+        //! \brief Number of timestamps that can be written with CommandListBuilder::WriteTimestamp().
+        //!
+        //! Must be zero if the adapter doesn't support timestamps, see AdapterCapabilities::TimestampPeriod.
+        UInt32 TimestampQueryCount = 0;
+
         inline CommandListDesc() = default;
 
         inline CommandListDesc(const char* name, HardwareQueueKindFlags queueKindFlags,
-                               CommandListFlags flags = CommandListFlags::None)
+                               CommandListFlags flags = CommandListFlags::None, UInt32 timestampQueryCount = 0)
             : Name(name)
             , QueueKindFlags(queueKindFlags)
             , Flags(flags)
+            , TimestampQueryCount(timestampQueryCount)
         {
         }
     };
@@ -64,8 +71,8 @@ namespace UN
     struct BufferCopyRegion
     {
         UInt64 Size         = 0; //!< Size of the copy region.
-        UInt32 SourceOffset = 0; //!< Offset in the source buffer.
-        UInt32 DestOffset   = 0; //!< Offset in the destination buffer.
+        UInt64 SourceOffset = 0; //!< Offset in the source buffer.
+        UInt64 DestOffset   = 0; //!< Offset in the destination buffer.
 
         inline BufferCopyRegion() = default;
 
@@ -76,7 +83,7 @@ namespace UN
         {
         }
 
-        inline BufferCopyRegion(UInt32 sourceOffset, UInt32 destOffset, UInt64 size)
+        inline BufferCopyRegion(UInt64 sourceOffset, UInt64 destOffset, UInt64 size)
             : Size(size)
             , SourceOffset(sourceOffset)
             , DestOffset(destOffset)
@@ -84,6 +91,41 @@ namespace UN
         }
     };
 
+    //! \brief Region for buffer to image and image to buffer copy commands.
+    //!
+    //! The texels are tightly packed in the buffer, rows and slices of the region follow each other without padding.
+    struct BufferImageCopyRegion
+    {
+        UInt64 BufferOffset = 0; //!< Offset in the buffer.
+        UInt32 ImageX       = 0; //!< X coordinate of the region in the image.
+        UInt32 ImageY       = 0; //!< Y coordinate of the region in the image.
+        UInt32 ImageZ       = 0; //!< Z coordinate of the region in the image.
+        UInt32 Width        = 0; //!< Width of the region in texels.
+        UInt32 Height       = 1; //!< Height of the region in texels.
+        UInt32 Depth        = 1; //!< Depth of the region in texels.
+
+        inline BufferImageCopyRegion() = default;
+
+        inline BufferImageCopyRegion(UInt32 width, UInt32 height, UInt32 depth = 1)
+            : Width(width)
+            , Height(height)
+            , Depth(depth)
+        {
+        }
+
+        inline BufferImageCopyRegion(UInt64 bufferOffset, UInt32 imageX, UInt32 imageY, UInt32 imageZ, UInt32 width,
+                                     UInt32 height, UInt32 depth)
+            : BufferOffset(bufferOffset)
+            , ImageX(imageX)
+            , ImageY(imageY)
+            , ImageZ(imageZ)
+            , Width(width)
+            , Height(height)
+            , Depth(depth)
+        {
+        }
+    };
+
     //! \brief Resource access flags used for memory barriers.
     enum class AccessFlags
     {
@@ -93,12 +135,14 @@ namespace UN
         TransferRead  = UN_BIT(3),
         TransferWrite = UN_BIT(4),
         HostRead      = UN_BIT(5),
-        HostWrite     = UN_BIT(6)
+        HostWrite     = UN_BIT(6),
+        IndirectRead  = UN_BIT(7)
     };
 
     UN_ENUM_OPERATORS(AccessFlags);
 
     class IBuffer;
+    class IImage;
 
     //! \brief Memory barrier descriptor.
     struct MemoryBarrierDesc
@@ -122,6 +166,14 @@ namespace UN
         }
     };
 
+    //! \brief Arguments of indirect dispatch command, must be stored in a buffer created with BufferUsage::Indirect.
+    struct DispatchIndirectArgs
+    {
+        UInt32 X = 0; //!< The number of local workgroups to dispatch in the X dimension.
+        UInt32 Y = 0; //!< The number of local workgroups to dispatch in the Y dimension.
+        UInt32 Z = 0; //!< The number of local workgroups to dispatch in the Z dimension.
+    };
+
     class IFence;
     class ICommandList;
     class IKernel;
@@ -132,6 +184,12 @@ namespace UN
         ICommandList* m_pCommandList;
 
     public:
+        //! \brief Pass as the size of Fill command to fill the buffer from the offset to its end.
+        inline static constexpr UInt64 WholeSize = std::numeric_limits<UInt64>::max();
+
+        //! \brief Maximum size of data that can be written to a buffer by a single Update command.
+        inline static constexpr UInt64 MaxUpdateSize = 64 * 1024;
+
         explicit CommandListBuilder(ICommandList* pCommandList);
         ~CommandListBuilder();
 
@@ -157,6 +215,12 @@ namespace UN
         //! \param barrierDesc - The barrier descriptor.
         void MemoryBarrier(IBuffer* pBuffer, const MemoryBarrierDesc& barrierDesc);
 
+        //! \brief Insert a memory dependency.
+        //!
+        //! \param pImage      - The image affected by the barrier.
+        //! \param barrierDesc - The barrier descriptor.
+        void MemoryBarrier(IImage* pImage, const MemoryBarrierDesc& barrierDesc);
+
         //! \brief Copy a region of the source buffer to the destination buffer.
         //!
         //! \param pSource      - Source buffer.
@@ -164,17 +228,91 @@ namespace UN
         //! \param region       - Copy region.
         void Copy(IBuffer* pSource, IBuffer* pDestination, const BufferCopyRegion& region);
 
+        //! \brief Copy multiple regions of the source buffer to the destination buffer in a single command.
+        //!
+        //! \param pSource      - Source buffer.
+        //! \param pDestination - Destination buffer.
+        //! \param regions      - Copy regions, must not be empty.
+        void Copy(IBuffer* pSource, IBuffer* pDestination, ArraySlice<const BufferCopyRegion> regions);
+
+        //! \brief Copy a region of the buffer to the image.
+        //!
+        //! \param pSource      - Source buffer.
+        //! \param pDestination - Destination image.
+        //! \param region       - Copy region.
+        void Copy(IBuffer* pSource, IImage* pDestination, const BufferImageCopyRegion& region);
+
+        //! \brief Copy a region of the image to the buffer.
+        //!
+        //! \param pSource      - Source image.
+        //! \param pDestination - Destination buffer.
+        //! \param region       - Copy region.
+        void Copy(IImage* pSource, IBuffer* pDestination, const BufferImageCopyRegion& region);
+
+        //! \brief Fill a region of the buffer with a repeated 32-bit value on the device.
+        //!
+        //! Can be used to clear a buffer without a host-visible staging buffer.
+        //!
+        //! \param pBuffer - The buffer to fill.
+        //! \param offset  - Byte offset of the region to fill, must be a multiple of 4.
+        //! \param size    - Size of the region to fill in bytes, must be a multiple of 4 or CommandListBuilder::WholeSize.
+        //! \param value   - The 32-bit value to fill the region with.
+        void Fill(IBuffer* pBuffer, UInt64 offset, UInt64 size, UInt32 value);
+
+        //! \brief Write a small amount of data to the buffer inline with the command list.
+        //!
+        //! The data is copied to the command list at the time of recording, so it can be freed right after the call.
+        //!
+        //! \param pBuffer - The buffer to update.
+        //! \param offset  - Byte offset of the region to update, must be a multiple of 4.
+        //! \param pData   - The data to write to the buffer.
+        //! \param size    - Size of the data in bytes, must be a non-zero multiple of 4 not greater than MaxUpdateSize.
+        void Update(IBuffer* pBuffer, UInt64 offset, const void* pData, UInt64 size);
+
         //! \brief Dispatch a compute kernel to execute on the device.
         //!
+        //! The workgroup counts must not exceed AdapterInfo::MaxWorkgroupCount. An oversize dispatch is not recorded and
+        //! the following ICommandList::Submit() returns ResultCode::InvalidArguments.
+        //!
         //! \param pKernel - The kernel to dispatch.
         //! \param x       - The number of local workgroups to dispatch in the X dimension.
         //! \param y       - The number of local workgroups to dispatch in the Y dimension.
         //! \param z       - The number of local workgroups to dispatch in the Z dimension.
         void Dispatch(IKernel* pKernel, Int32 x, Int32 y, Int32 z);
 
+        //! \brief Dispatch a compute kernel with the workgroup counts read from a buffer on the device.
+        //!
+        //! The buffer must contain an instance of DispatchIndirectArgs at the specified offset. This allows the previous
+        //! kernels to compute the size of the dispatch without reading the data back to the host.
+        //!
+        //! \param pKernel     - The kernel to dispatch.
+        //! \param pArgsBuffer - The buffer created with BufferUsage::Indirect that stores the dispatch arguments.
+        //! \param offset      - Byte offset of DispatchIndirectArgs in the buffer, must be a multiple of 4.
+        void DispatchIndirect(IKernel* pKernel, IBuffer* pArgsBuffer, UInt64 offset = 0);
+
+        //! \brief Write the device time to a timestamp query once all the previously recorded commands are complete.
+        //!
+        //! The difference between two timestamps is the device time spent on the commands recorded between them.
+        //! The values can be read with ICommandList::GetTimestamps() after the command list is executed.
+        //!
+        //! \param index - Index of the query, must be less than CommandListDesc::TimestampQueryCount.
+        void WriteTimestamp(UInt32 index);
+
         explicit operator bool();
     };
 
+    //! \brief A function called once the work submitted with ICommandList::Submit(CommandListCompletionCallback, void*)
+    //!        is complete.
+    //!
+    //! The callback is called on a thread owned by the compute device and must not block it for long, since the
+    //! completion of other command lists is not reported until it returns. If the device is reset while the work is
+    //! pending, the callback is called with ResultCode::Abort on the thread that resets the device.
+    //!
+    //! \param pCommandList - The submitted command list.
+    //! \param result       - ResultCode::Success or an error code if the device couldn't wait for the work.
+    //! \param pUserData    - User data passed to Submit().
+    using CommandListCompletionCallback = void (*)(ICommandList* pCommandList, ResultCode result, void* pUserData);
+
     //! \brief An interface for command lists that record commands to be executed by the backend.
     class ICommandList : public IDeviceObject
     {
@@ -183,9 +321,16 @@ namespace UN
     protected:
         virtual void End() = 0;
 
-        virtual void CmdMemoryBarrier(IBuffer* pBuffer, const MemoryBarrierDesc& barrierDesc)         = 0;
-        virtual void CmdCopy(IBuffer* pSource, IBuffer* pDestination, const BufferCopyRegion& region) = 0;
-        virtual void CmdDispatch(IKernel* pKernel, Int32 x, Int32 y, Int32 z)                         = 0;
+        virtual void CmdMemoryBarrier(IBuffer* pBuffer, const MemoryBarrierDesc& barrierDesc)                   = 0;
+        virtual void CmdMemoryBarrier(IImage* pImage, const MemoryBarrierDesc& barrierDesc)                     = 0;
+        virtual void CmdCopy(IBuffer* pSource, IBuffer* pDestination, ArraySlice<const BufferCopyRegion> regions) = 0;
+        virtual void CmdCopy(IBuffer* pSource, IImage* pDestination, const BufferImageCopyRegion& region)       = 0;
+        virtual void CmdCopy(IImage* pSource, IBuffer* pDestination, const BufferImageCopyRegion& region)       = 0;
+        virtual void CmdFill(IBuffer* pBuffer, UInt64 offset, UInt64 size, UInt32 value)                        = 0;
+        virtual void CmdUpdate(IBuffer* pBuffer, UInt64 offset, const void* pData, UInt64 size)                 = 0;
+        virtual void CmdDispatch(IKernel* pKernel, Int32 x, Int32 y, Int32 z)                                   = 0;
+        virtual void CmdDispatchIndirect(IKernel* pKernel, IBuffer* pArgsBuffer, UInt64 offset)                 = 0;
+        virtual void CmdWriteTimestamp(UInt32 index)                                                            = 0;
 
     public:
         using DescriptorType = CommandListDesc;
@@ -207,7 +352,29 @@ namespace UN
         virtual void ResetState() = 0;
 
         //! \brief Submit the command list and set the state to CommandListState::Pending.
+        //!
+        //! \return ResultCode::Success or an error code, ResultCode::InvalidArguments if an invalid command was recorded.
         virtual ResultCode Submit() = 0;
+
+        //! \brief Submit the command list and call a function when its fence is signaled.
+        //!
+        //! The command list must be kept alive and must not be reset or submitted again until the callback is called.
+        //!
+        //! \param callback  - The function to call when the submitted work is complete.
+        //! \param pUserData - User data to pass to the callback.
+        //!
+        //! \return ResultCode::Success or an error code, the callback is not called if the submission failed.
+        virtual ResultCode Submit(CommandListCompletionCallback callback, void* pUserData) = 0;
+
+        //! \brief Get the timestamps written by the last execution of the command list in nanoseconds.
+        //!
+        //! The command list must not be pending. Only differences between the timestamps are meaningful.
+        //!
+        //! \param timestamps - A slice where the first timestamps.Length() queries will be written, the length must not
+        //!                     exceed CommandListDesc::TimestampQueryCount.
+        //!
+        //! \return ResultCode::Success or an error code.
+        virtual ResultCode GetTimestamps(ArraySlice<UInt64> timestamps) = 0;
     };
 
     inline CommandListBuilder::CommandListBuilder(ICommandList* pCommandList)
@@ -229,16 +396,66 @@ namespace UN
         m_pCommandList->CmdMemoryBarrier(pBuffer, barrierDesc);
     }
 
+    inline void CommandListBuilder::MemoryBarrier(IImage* pImage, const MemoryBarrierDesc& barrierDesc)
+    {
+        m_pCommandList->CmdMemoryBarrier(pImage, barrierDesc);
+    }
+
     inline void CommandListBuilder::Copy(IBuffer* pSource, IBuffer* pDestination, const BufferCopyRegion& region)
+    {
+        m_pCommandList->CmdCopy(pSource, pDestination, ArraySlice<const BufferCopyRegion>(&region, 1));
+    }
+
+    inline void CommandListBuilder::Copy(IBuffer* pSource, IBuffer* pDestination, ArraySlice<const BufferCopyRegion> regions)
+    {
+        UN_Assert(regions.Any(), "Copy command must have at least one region");
+        m_pCommandList->CmdCopy(pSource, pDestination, regions);
+    }
+
+    inline void CommandListBuilder::Copy(IBuffer* pSource, IImage* pDestination, const BufferImageCopyRegion& region)
+    {
+        m_pCommandList->CmdCopy(pSource, pDestination, region);
+    }
+
+    inline void CommandListBuilder::Copy(IImage* pSource, IBuffer* pDestination, const BufferImageCopyRegion& region)
     {
         m_pCommandList->CmdCopy(pSource, pDestination, region);
     }
 
+    inline void CommandListBuilder::Fill(IBuffer* pBuffer, UInt64 offset, UInt64 size, UInt32 value)
+    {
+        UN_Assert(offset % 4 == 0, "Fill offset must be a multiple of 4");
+        UN_Assert(size == WholeSize || size % 4 == 0, "Fill size must be a multiple of 4");
+        m_pCommandList->CmdFill(pBuffer, offset, size, value);
+    }
+
+    inline void CommandListBuilder::Update(IBuffer* pBuffer, UInt64 offset, const void* pData, UInt64 size)
+    {
+        UN_Assert(offset % 4 == 0, "Update offset must be a multiple of 4");
+        UN_Assert(size > 0, "Update size must not be zero");
+        UN_Assert(size % 4 == 0, "Update size must be a multiple of 4");
+        UN_Assert(size <= MaxUpdateSize, "Update size must not be greater than {} bytes", MaxUpdateSize);
+        m_pCommandList->CmdUpdate(pBuffer, offset, pData, size);
+    }
+
     inline void CommandListBuilder::Dispatch(IKernel* pKernel, Int32 x, Int32 y, Int32 z)
     {
+        UN_Assert(x >= 0 && y >= 0 && z >= 0, "Workgroup counts must not be negative: {}x{}x{}", x, y, z);
         m_pCommandList->CmdDispatch(pKernel, x, y, z);
     }
 
+    inline void CommandListBuilder::DispatchIndirect(IKernel* pKernel, IBuffer* pArgsBuffer, UInt64 offset)
+    {
+        UN_Assert(offset % 4 == 0, "Indirect dispatch arguments offset must be a multiple of 4");
+        m_pCommandList->CmdDispatchIndirect(pKernel, pArgsBuffer, offset);
+    }
+
+    inline void CommandListBuilder::WriteTimestamp(UInt32 index)
+    {
+        UN_Assert(index < m_pCommandList->GetDesc().TimestampQueryCount, "Timestamp query index {} is out of range", index);
+        m_pCommandList->CmdWriteTimestamp(index);
+    }
+
     inline CommandListBuilder::operator bool()
     {
         return m_pCommandList != nullptr;
@@ -1,4 +1,5 @@
 #pragma once
+#include <UnCompute/Acceleration/AdapterCapabilities.h>
 #include <UnCompute/Backend/BaseTypes.h>
 #include <UnCompute/Backend/IDeviceObject.h>
 
@@ -7,21 +8,44 @@ namespace UN
     //! \brief Compute device descriptor.
     struct ComputeDeviceDesc
     {
-        UInt32 AdapterId; //!< ID of the adapter to create the device on.
+        UInt32 AdapterId;                    //!< ID of the adapter to create the device on.
+        DeviceFeatureFlags RequiredFeatures; //!< Optional features to enable, device creation fails if any are not supported.
 
         inline ComputeDeviceDesc()
             : AdapterId(0)
+            , RequiredFeatures(DeviceFeatureFlags::None)
         {
         }
 
-        inline explicit ComputeDeviceDesc(UInt32 adapterId)
+        inline explicit ComputeDeviceDesc(UInt32 adapterId, DeviceFeatureFlags requiredFeatures = DeviceFeatureFlags::None)
             : AdapterId(adapterId)
+            , RequiredFeatures(requiredFeatures)
         {
         }
     };
 
+    //! \brief Memory budget and usage of a single device memory heap.
+    struct MemoryHeapBudget
+    {
+        UInt64 Budget;         //!< Estimated amount of memory the process can allocate from the heap without failures.
+        UInt64 Usage;          //!< Estimated amount of memory currently used by the process, including other APIs.
+        UInt64 AllocatedBytes; //!< Number of bytes allocated from the heap through the device's IDeviceMemory objects.
+    };
+
+    //! \brief Memory budget and usage of all device memory heaps.
+    //!
+    //! The heaps are in the same order as in AdapterCapabilities::MemoryHeaps.
+    struct MemoryBudget
+    {
+        UInt64 TotalAllocatedBytes;                                  //!< Sum of MemoryHeapBudget::AllocatedBytes.
+        UInt32 HeapCount;                                            //!< Number of valid elements in Heaps.
+        MemoryHeapBudget Heaps[AdapterCapabilities::MaxMemoryHeaps]; //!< Device memory heaps.
+    };
+
     class IFence;
     class IBuffer;
+    class IImage;
+    class ISampler;
     class IDeviceMemory;
     class ICommandList;
     class IResourceBinding;
@@ -47,8 +71,25 @@ namespace UN
         //! \brief Reset the object to uninitialized state.
         virtual void Reset() = 0;
 
+        //! \brief Get current memory budget and usage of the device.
+        //!
+        //! If the backend can't query the budget from the driver, the heap size is reported as the budget and
+        //! the memory allocated through the device is reported as the usage.
+        //!
+        //! \param pBudget - A pointer to memory where the budget will be written.
+        //!
+        //! \return ResultCode::Success or an error code.
+        virtual ResultCode GetMemoryBudget(MemoryBudget* pBudget) = 0;
+
+        //! \brief Get information about the adapter the device was created on.
+        [[nodiscard]] virtual const AdapterInfo& GetAdapterInfo() const = 0;
+
         virtual ResultCode CreateBuffer(IBuffer** ppBuffer) = 0;
 
+        virtual ResultCode CreateImage(IImage** ppImage) = 0;
+
+        virtual ResultCode CreateSampler(ISampler** ppSampler) = 0;
+
         virtual ResultCode CreateMemory(IDeviceMemory** ppMemory) = 0;
 
         virtual ResultCode CreateFence(IFence** ppFence) = 0;
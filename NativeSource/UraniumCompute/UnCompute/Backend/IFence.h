@@ -58,5 +58,17 @@ namespace UN
 
         //! \brief Get current fence state.
         virtual FenceState GetState() = 0;
+
+        //! \brief Export a file descriptor that becomes readable when the fence is signaled.
+        //!
+        //! The descriptor can be added to poll, epoll or io_uring to wait for many submissions without blocking
+        //! a thread per fence. The caller owns the returned descriptor and must close it. The fence must be signaled
+        //! or have a pending signal operation, i.e. the command list that signals it must already be submitted.
+        //!
+        //! \param pFileDescriptor - A pointer to the variable that receives the file descriptor.
+        //!
+        //! \return ResultCode::Success, ResultCode::NotImplemented if not supported by the platform or the device,
+        //!         or an error code.
+        virtual ResultCode ExportCompletionFd(Int32* pFileDescriptor) = 0;
     };
 } // namespace UN
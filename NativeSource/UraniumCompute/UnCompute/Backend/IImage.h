@@ -0,0 +1,113 @@
+#pragma once
+#include <UnCompute/Backend/Format.h>
+#include <UnCompute/Backend/IDeviceObject.h>
+#include <UnCompute/Base/Flags.h>
+
+namespace UN
+{
+    //! \brief Number of image dimensions.
+    enum class ImageDimension
+    {
+        Image1D, //!< One-dimensional image.
+        Image2D, //!< Two-dimensional image.
+        Image3D  //!< Three-dimensional image.
+    };
+
+    //! \brief Image usage flags.
+    //!
+    //! Images can always be used as a source and a destination of copy commands.
+    enum class ImageUsageFlags
+    {
+        None    = 0,
+        Sampled = UN_BIT(0), //!< The image can be bound as KernelResourceKind::SampledTexture.
+        Storage = UN_BIT(1)  //!< The image can be bound as KernelResourceKind::RWTexture.
+    };
+
+    UN_ENUM_OPERATORS(ImageUsageFlags);
+
+    //! \brief Image descriptor.
+    struct ImageDesc
+    {
+        const char* Name         = nullptr;                  //!< Image debug name.
+        ImageDimension Dimension = ImageDimension::Image2D;  //!< Number of image dimensions.
+        UN::Format Format        = UN::Format::None;         //!< Format of image texels.
+        UInt32 Width             = 1;                        //!< Image width in texels.
+        UInt32 Height            = 1;                        //!< Image height in texels, must be 1 for 1D images.
+        UInt32 Depth             = 1;                        //!< Image depth in texels, must be 1 for 1D and 2D images.
+        ImageUsageFlags Usage    = ImageUsageFlags::Storage; //!< Image usage flags.
+
+        inline ImageDesc() = default;
+
+        inline ImageDesc(const char* name, UN::Format format, UInt32 width, UInt32 height,
+                         ImageUsageFlags usage = ImageUsageFlags::Storage)
+            : Name(name)
+            , Dimension(ImageDimension::Image2D)
+            , Format(format)
+            , Width(width)
+            , Height(height)
+            , Depth(1)
+            , Usage(usage)
+        {
+        }
+
+        inline ImageDesc(const char* name, ImageDimension dimension, UN::Format format, UInt32 width, UInt32 height,
+                         UInt32 depth, ImageUsageFlags usage = ImageUsageFlags::Storage)
+            : Name(name)
+            , Dimension(dimension)
+            , Format(format)
+            , Width(width)
+            , Height(height)
+            , Depth(depth)
+            , Usage(usage)
+        {
+        }
+
+        //! \brief Get the size of image data in bytes when it is tightly packed in a buffer.
+        [[nodiscard]] inline UInt64 GetDataSize() const
+        {
+            return static_cast<UInt64>(Width) * Height * Depth * GetFormatSize(Format);
+        }
+    };
+
+    class IDeviceMemory;
+    class DeviceMemorySlice;
+
+    //! \brief An interface for backend-specific images that store 1D, 2D or 3D texel data on the device.
+    //!
+    //! Unlike buffers, images can use tiled memory layouts and texture caches, which is beneficial for kernels
+    //! that access neighbouring elements in multiple dimensions.
+    class IImage : public IDeviceObject
+    {
+    public:
+        using DescriptorType = ImageDesc;
+
+        [[nodiscard]] virtual const DescriptorType& GetDesc() const = 0;
+
+        //! \brief Creates and initializes a backend-specific image object.
+        //!
+        //! \param desc - Image descriptor.
+        //!
+        //! \return ResultCode::Success or an error code.
+        virtual ResultCode Init(const ImageDesc& desc) = 0;
+
+        //! \brief Bind device memory to the image.
+        //!
+        //! Image doesn't allocate any device memory itself on creation or initialization.
+        //! So the memory must be allocated separately and than bound to the image using this function.
+        //!
+        //! \param deviceMemory - The memory to bind.
+        //!
+        //! \return ResultCode::Success or an error code (if the memory was incompatible).
+        virtual ResultCode BindMemory(const DeviceMemorySlice& deviceMemory) = 0;
+
+        //! \brief Bind device memory to the image.
+        //!
+        //! Image doesn't allocate any device memory itself on creation or initialization.
+        //! So the memory must be allocated separately and than bound to the image using this function.
+        //!
+        //! \param pDeviceMemory - The memory to bind.
+        //!
+        //! \return ResultCode::Success or an error code (if the memory was incompatible).
+        virtual ResultCode BindMemory(IDeviceMemory* pDeviceMemory) = 0;
+    };
+} // namespace UN
@@ -7,6 +7,57 @@ namespace UN
 {
     class IResourceBinding;
 
+    //! \brief Number of kernel invocations in a workgroup, declared with `[numthreads(X, Y, Z)]` in HLSL.
+    struct WorkgroupSize
+    {
+        UInt32 X = 1; //!< Number of invocations along the X axis.
+        UInt32 Y = 1; //!< Number of invocations along the Y axis.
+        UInt32 Z = 1; //!< Number of invocations along the Z axis.
+
+        inline WorkgroupSize() = default;
+
+        inline WorkgroupSize(UInt32 x, UInt32 y, UInt32 z)
+            : X(x)
+            , Y(y)
+            , Z(z)
+        {
+        }
+
+        //! \brief Get the total number of invocations in a workgroup.
+        [[nodiscard]] inline UInt32 GetInvocationCount() const
+        {
+            return X * Y * Z;
+        }
+
+        //! \brief Get the number of workgroups to dispatch along the X axis to run at least invocationCount invocations.
+        [[nodiscard]] inline UInt64 GetGroupCountX(UInt64 invocationCount) const
+        {
+            return (invocationCount + X - 1) / X;
+        }
+
+        //! \brief Get the number of workgroups to dispatch along the Y axis to run at least invocationCount invocations.
+        [[nodiscard]] inline UInt64 GetGroupCountY(UInt64 invocationCount) const
+        {
+            return (invocationCount + Y - 1) / Y;
+        }
+
+        //! \brief Get the number of workgroups to dispatch along the Z axis to run at least invocationCount invocations.
+        [[nodiscard]] inline UInt64 GetGroupCountZ(UInt64 invocationCount) const
+        {
+            return (invocationCount + Z - 1) / Z;
+        }
+
+        inline friend bool operator==(const WorkgroupSize& lhs, const WorkgroupSize& rhs)
+        {
+            return lhs.X == rhs.X && lhs.Y == rhs.Y && lhs.Z == rhs.Z;
+        }
+
+        inline friend bool operator!=(const WorkgroupSize& lhs, const WorkgroupSize& rhs)
+        {
+            return !(lhs == rhs);
+        }
+    };
+
     //! \brief Kernel descriptor.
     struct KernelDesc
     {
@@ -14,6 +65,12 @@ namespace UN
         IResourceBinding* pResourceBinding = nullptr; //!< Resource binding object that binds resources for the kernel.
         ArraySlice<const Byte> Bytecode;              //!< Kernel program bytecode.
 
+        //! \brief Number of invocations in a subgroup (wave) the kernel must be run with, zero to let the driver choose.
+        //!
+        //! Must be a power of two in range [AdapterInfo::MinSubgroupSize, AdapterInfo::MaxSubgroupSize].
+        //! Kernels that use wave intrinsics and rely on a specific wave size (e.g. reductions and scans) should set it.
+        UInt32 RequiredSubgroupSize = 0;
+
         inline KernelDesc() = default;
 
         inline KernelDesc(const char* name, IResourceBinding* pResourceBinding, const ArraySlice<const Byte>& bytecode)
@@ -38,5 +95,8 @@ namespace UN
         //!
         //! \return ResultCode::Success or an error code.
         virtual ResultCode Init(const DescriptorType& desc) = 0;
+
+        //! \brief Get the workgroup size declared in the kernel bytecode.
+        [[nodiscard]] virtual WorkgroupSize GetWorkgroupSize() const = 0;
     };
 } // namespace UN
@@ -1,4 +1,5 @@
 #pragma once
+#include <UnCompute/Backend/Format.h>
 #include <UnCompute/Backend/IDeviceMemory.h>
 
 namespace UN
@@ -6,9 +7,9 @@ namespace UN
     //! \brief Kind of resource that is bound to a kernel.
     enum class KernelResourceKind
     {
-        Buffer,         //!< Read-only buffer.
+        Buffer,         //!< Read-only buffer, typed if a texel format is specified.
         ConstantBuffer, //!< Constant buffer.
-        RWBuffer,       //!< Storage buffer with unordered access.
+        RWBuffer,       //!< Storage buffer with unordered access, typed if a texel format is specified.
         SampledTexture, //!< Read-only sampled image.
         RWTexture,      //!< Storage image with unordered access.
         Sampler         //!< Texture sampler.
@@ -20,12 +21,35 @@ namespace UN
         Int32 BindingIndex      = -1;                         //!< Binding index in the compute shader source.
         KernelResourceKind Kind = KernelResourceKind::Buffer; //!< Kind of resource that is bound to a kernel.
 
+        //! \brief Texel format of a typed buffer, the data is converted by the hardware when accessed by the kernel.
+        //!
+        //! Must be Format::None for structured and byte address buffers. Only used for KernelResourceKind::Buffer and
+        //! KernelResourceKind::RWBuffer, e.g. `Buffer<float>` declared in a kernel can read R8_UNorm data.
+        UN::Format Format = UN::Format::None;
+
         inline KernelResourceDesc() = default;
 
-        inline KernelResourceDesc(Int32 bindingIndex, KernelResourceKind kind)
+        inline KernelResourceDesc(Int32 bindingIndex, KernelResourceKind kind, UN::Format format = UN::Format::None)
             : BindingIndex(bindingIndex)
             , Kind(kind)
+            , Format(format)
+        {
+        }
+
+        //! \brief Check if the resource is a typed (texel) buffer.
+        [[nodiscard]] inline bool IsTexelBuffer() const
+        {
+            return Format != UN::Format::None && (Kind == KernelResourceKind::Buffer || Kind == KernelResourceKind::RWBuffer);
+        }
+
+        inline friend bool operator==(const KernelResourceDesc& lhs, const KernelResourceDesc& rhs)
+        {
+            return lhs.BindingIndex == rhs.BindingIndex && lhs.Kind == rhs.Kind && lhs.Format == rhs.Format;
+        }
+
+        inline friend bool operator!=(const KernelResourceDesc& lhs, const KernelResourceDesc& rhs)
         {
+            return !(lhs == rhs);
         }
     };
 
@@ -45,6 +69,8 @@ namespace UN
     };
 
     class IBuffer;
+    class IImage;
+    class ISampler;
 
     //! \brief Resource binding object used to bind resources to a compute kernel.
     class IResourceBinding : public IDeviceObject
@@ -62,6 +88,22 @@ namespace UN
         //! \return ResultCode::Success or an error code.
         virtual ResultCode SetVariable(Int32 bindingIndex, IBuffer* pBuffer) = 0;
 
+        //! \brief Set kernel variable.
+        //!
+        //! \param bindingIndex - Binding index of the variable to set.
+        //! \param pImage       - The image to assign, the variable must be a SampledTexture or a RWTexture.
+        //!
+        //! \return ResultCode::Success or an error code.
+        virtual ResultCode SetVariable(Int32 bindingIndex, IImage* pImage) = 0;
+
+        //! \brief Set kernel variable.
+        //!
+        //! \param bindingIndex - Binding index of the variable to set.
+        //! \param pSampler     - The sampler to assign, the variable must be a Sampler.
+        //!
+        //! \return ResultCode::Success or an error code.
+        virtual ResultCode SetVariable(Int32 bindingIndex, ISampler* pSampler) = 0;
+
         virtual ResultCode Init(const DescriptorType& desc) = 0;
     };
 } // namespace UN
@@ -0,0 +1,56 @@
+#pragma once
+#include <UnCompute/Backend/IDeviceObject.h>
+
+namespace UN
+{
+    //! \brief Texel filtering mode used when a sampled image is read with a sampler.
+    enum class SamplerFilter
+    {
+        Nearest, //!< Use the nearest texel.
+        Linear   //!< Linearly interpolate between the neighbouring texels.
+    };
+
+    //! \brief Sampler behaviour for coordinates outside of the image.
+    enum class SamplerAddressMode
+    {
+        Repeat,         //!< Wrap the coordinates around the image.
+        MirroredRepeat, //!< Wrap the coordinates around the image and mirror every other repetition.
+        ClampToEdge,    //!< Clamp the coordinates to the edge texels.
+        ClampToBorder   //!< Return transparent black for coordinates outside of the image.
+    };
+
+    //! \brief Sampler descriptor.
+    //!
+    //! Texel coordinates (NormalizedCoordinates = false) can only be used with SamplerAddressMode::ClampToEdge and
+    //! SamplerAddressMode::ClampToBorder, ISampler::Init() returns ResultCode::InvalidArguments for the repeating modes.
+    struct SamplerDesc
+    {
+        const char* Name               = nullptr;                         //!< Sampler debug name.
+        SamplerFilter Filter           = SamplerFilter::Linear;           //!< Texel filtering mode.
+        SamplerAddressMode AddressMode = SamplerAddressMode::ClampToEdge; //!< Addressing mode for all dimensions.
+        bool NormalizedCoordinates     = true; //!< True if the coordinates are in range [0, 1], false for texel coordinates.
+
+        inline SamplerDesc() = default;
+
+        inline explicit SamplerDesc(const char* name, SamplerFilter filter = SamplerFilter::Linear,
+                                    SamplerAddressMode addressMode = SamplerAddressMode::ClampToEdge,
+                                    bool normalizedCoordinates     = true)
+            : Name(name)
+            , Filter(filter)
+            , AddressMode(addressMode)
+            , NormalizedCoordinates(normalizedCoordinates)
+        {
+        }
+    };
+
+    //! \brief An interface for texture samplers that are used by kernels to read sampled images.
+    class ISampler : public IDeviceObject
+    {
+    public:
+        using DescriptorType = SamplerDesc;
+
+        [[nodiscard]] virtual const DescriptorType& GetDesc() const = 0;
+
+        virtual ResultCode Init(const DescriptorType& desc) = 0;
+    };
+} // namespace UN
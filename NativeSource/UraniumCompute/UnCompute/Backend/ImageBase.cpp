@@ -0,0 +1,10 @@
+#include <UnCompute/Backend/ImageBase.h>
+
+namespace UN
+{
+    ResultCode ImageBase::Init(const DescriptorType& desc)
+    {
+        DeviceObjectBase::Init(desc.Name, desc);
+        return InitInternal(desc);
+    }
+} // namespace UN
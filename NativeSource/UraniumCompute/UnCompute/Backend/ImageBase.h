@@ -0,0 +1,20 @@
+#pragma once
+#include <UnCompute/Backend/DeviceObjectBase.h>
+#include <UnCompute/Backend/IImage.h>
+
+namespace UN
+{
+    class ImageBase : public DeviceObjectBase<IImage>
+    {
+    protected:
+        virtual ResultCode InitInternal(const DescriptorType& desc) = 0;
+
+        inline explicit ImageBase(IComputeDevice* pDevice)
+            : DeviceObjectBase(pDevice)
+        {
+        }
+
+    public:
+        ResultCode Init(const DescriptorType& desc) override;
+    };
+} // namespace UN
@@ -7,4 +7,9 @@ namespace UN
         DeviceObjectBase::Init(desc.Name, desc);
         return InitInternal(desc);
     }
+
+    WorkgroupSize KernelBase::GetWorkgroupSize() const
+    {
+        return m_WorkgroupSize;
+    }
 } // namespace UN
@@ -7,6 +7,8 @@ namespace UN
     class KernelBase : public DeviceObjectBase<IKernel>
     {
     protected:
+        WorkgroupSize m_WorkgroupSize;
+
         virtual ResultCode InitInternal(const DescriptorType& desc) = 0;
 
         inline explicit KernelBase(IComputeDevice* pDevice)
@@ -16,5 +18,6 @@ namespace UN
 
     public:
         ResultCode Init(const DescriptorType& desc) override;
+        [[nodiscard]] WorkgroupSize GetWorkgroupSize() const override;
     };
 } // namespace UN
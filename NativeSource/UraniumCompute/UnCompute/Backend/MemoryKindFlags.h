@@ -12,4 +12,6 @@ namespace UN
 
         HostAndDeviceAccessible = HostAccessible | DeviceAccessible //!< Memory accessible for both the device and the host.
     };
+
+    UN_ENUM_OPERATORS(MemoryKindFlags);
 }
@@ -0,0 +1,10 @@
+#include <UnCompute/Backend/SamplerBase.h>
+
+namespace UN
+{
+    ResultCode SamplerBase::Init(const DescriptorType& desc)
+    {
+        DeviceObjectBase::Init(desc.Name, desc);
+        return InitInternal(desc);
+    }
+} // namespace UN
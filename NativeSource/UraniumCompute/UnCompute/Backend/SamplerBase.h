@@ -0,0 +1,20 @@
+#pragma once
+#include <UnCompute/Backend/DeviceObjectBase.h>
+#include <UnCompute/Backend/ISampler.h>
+
+namespace UN
+{
+    class SamplerBase : public DeviceObjectBase<ISampler>
+    {
+    protected:
+        virtual ResultCode InitInternal(const DescriptorType& desc) = 0;
+
+        inline explicit SamplerBase(IComputeDevice* pDevice)
+            : DeviceObjectBase(pDevice)
+        {
+        }
+
+    public:
+        ResultCode Init(const DescriptorType& desc) override;
+    };
+} // namespace UN
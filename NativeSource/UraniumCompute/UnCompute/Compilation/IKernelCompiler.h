@@ -1,5 +1,8 @@
 #pragma once
+#include <UnCompute/Acceleration/AdapterInfo.h>
+#include <UnCompute/Backend/BaseTypes.h>
 #include <UnCompute/Base/Byte.h>
+#include <UnCompute/Compilation/KernelReflection.h>
 #include <UnCompute/Containers/HeapArray.h>
 #include <UnCompute/Memory/Object.h>
 
@@ -8,7 +11,7 @@ namespace UN
     //! \brief Source language of compute shader compilation.
     enum class KernelSourceLang
     {
-        Hlsl //!< High-Level Shader Language, cs_6_0 profile
+        Hlsl //!< High-Level Shader Language, cs_6_x profile selected by KernelCompilerDesc::ShaderModel
     };
 
     //! \brief Target language of compute shader compilation.
@@ -24,14 +27,45 @@ namespace UN
         KernelSourceLang SourceLang = KernelSourceLang::Hlsl;  //!< Source code language.
         KernelTargetLang TargetLang = KernelTargetLang::SpirV; //!< Target code language.
 
+        //! \brief Directory of the persistent compilation cache, null to keep compiled kernels in memory only.
+        const char* CacheDirectory = nullptr;
+
+        //! \brief Maximum number of compiled kernels kept in memory, zero disables the cache if no directory is set.
+        UInt32 MemoryCacheCapacity = 64;
+
+        //! \brief Environment the kernels run in, must not be newer than AdapterInfo::TargetEnv of the device's adapter.
+        //!
+        //! Newer environments let the compiler use newer SPIR-V versions and capabilities, which generally results
+        //! in better code.
+        KernelTargetEnv TargetEnv = KernelTargetEnv::Vulkan1_1;
+
+        //! \brief Minimum shader model of the kernels, must not be newer than AdapterInfo::ShaderModel.
+        //!
+        //! The compiler raises the shader model if a kernel uses features that require a newer one, see
+        //! KernelCompilerArgs::Features.
+        KernelShaderModel ShaderModel = KernelShaderModel::SM6_0;
+
         inline KernelCompilerDesc() = default;
 
         inline explicit KernelCompilerDesc(const char* name, KernelSourceLang sourceLang = KernelSourceLang::Hlsl,
-                                           KernelTargetLang targetLang = KernelTargetLang::SpirV)
+                                           KernelTargetLang targetLang = KernelTargetLang::SpirV,
+                                           const char* cacheDirectory = nullptr, UInt32 memoryCacheCapacity = 64)
             : Name(name)
             , SourceLang(sourceLang)
             , TargetLang(targetLang)
+            , CacheDirectory(cacheDirectory)
+            , MemoryCacheCapacity(memoryCacheCapacity)
+        {
+        }
+
+        //! \brief Target the newest environment and shader model supported by an adapter.
+        //!
+        //! \param adapter - The adapter of the device the compiled kernels will run on.
+        inline KernelCompilerDesc& SetTarget(const AdapterInfo& adapter)
         {
+            TargetEnv   = adapter.TargetEnv;
+            ShaderModel = adapter.ShaderModel;
+            return *this;
         }
     };
 
@@ -45,6 +79,21 @@ namespace UN
         Max = O3 //!< Maximum level of optimization supported by the compiler.
     };
 
+    //! \brief Flags that enable additional SPIR-V optimizer passes, ignored for other target languages.
+    //!
+    //! The passes run after the optimization passes selected by CompilerOptimizationLevel. The flags are ignored with
+    //! CompilerOptimizationLevel::None, since the SPIR-V optimizer doesn't run at all in this case.
+    enum class SpirVOptimizerFlags
+    {
+        None = 0, //!< Only run the passes selected by the optimization level.
+
+        OptimizeSize   = UN_BIT(0), //!< Run the size reduction recipe instead of the performance one.
+        StripDebugInfo = UN_BIT(1), //!< Remove debug names, source information and non-semantic decorations.
+        CompactIds     = UN_BIT(2)  //!< Renumber the result IDs densely, so that the module compresses better.
+    };
+
+    UN_ENUM_OPERATORS(SpirVOptimizerFlags);
+
     //! Compiler `#define` descriptor.
     struct CompilerDefinition
     {
@@ -67,6 +116,17 @@ namespace UN
         CompilerOptimizationLevel OptimizationLevel = CompilerOptimizationLevel::Max; //!< Compiler optimization level.
         const char* EntryPoint                      = "main";                         //!< Compute shader entry point.
         ArraySlice<CompilerDefinition> Definitions;                                   //!< Compiler definitions.
+
+        //! \brief Optional device features used by the kernel.
+        //!
+        //! DeviceFeatureFlags::Float16, DeviceFeatureFlags::Int16 and DeviceFeatureFlags::Storage16Bit enable native
+        //! 16-bit types (float16_t, int16_t, uint16_t) and require the cs_6_2 profile, DeviceFeatureFlags::Int64Atomics
+        //! requires the cs_6_6 profile. The device the kernel runs on must be created with the same features
+        //! in ComputeDeviceDesc::RequiredFeatures.
+        DeviceFeatureFlags Features = DeviceFeatureFlags::None;
+
+        //! \brief Additional SPIR-V optimizer passes, e.g. to make the module smaller so that pipelines are created faster.
+        SpirVOptimizerFlags OptimizerFlags = SpirVOptimizerFlags::None;
     };
 
     //! \brief An interface for kernel compiler that is used for compiling compute shader source into backend's native code.
@@ -84,12 +144,63 @@ namespace UN
         //! \return ResultCode::Success or an error code.
         virtual ResultCode Init(const DescriptorType& desc) = 0;
 
+        //! \brief Register a header that kernels can include with `#include "name"`.
+        //!
+        //! Registered headers are kept in memory and reused by all the following compilations, they are a part of the
+        //! compilation cache key. Headers that were not registered are read from disk on every compilation, the kernels
+        //! that include them are never stored in the cache.
+        //!
+        //! \param name   - The name used in `#include` directives.
+        //! \param source - The source code of the header, it is copied.
+        //!
+        //! \return ResultCode::Success or an error code.
+        virtual ResultCode RegisterInclude(const char* name, ArraySlice<const Byte> source) = 0;
+
+        //! \brief Read a header from disk once and register it, see RegisterInclude().
+        //!
+        //! \param name - The name used in `#include` directives.
+        //! \param path - Path to the header file.
+        //!
+        //! \return ResultCode::Success or an error code.
+        virtual ResultCode RegisterIncludeFile(const char* name, const char* path) = 0;
+
         //! \brief Compile a compute kernel into target language.
         //!
+        //! Returns the cached bytecode without invoking the compiler if a kernel with the same inputs has already been
+        //! compiled, see KernelCompilerDesc::CacheDirectory and KernelCompilerDesc::MemoryCacheCapacity.
+        //!
         //! \param args    - Compiler arguments.
         //! \param pResult - A pointer to an array where the compiled bytecode will be written.
         //!
         //! \return ResultCode::Success or an error code.
         virtual ResultCode Compile(const KernelCompilerArgs& args, HeapArray<Byte>* pResult) = 0;
+
+        //! \brief Compile multiple compute kernels concurrently.
+        //!
+        //! The kernels are compiled on the calling thread and a pool of worker threads that is kept alive between the
+        //! calls, each thread uses its own compiler instance. A failed compilation doesn't stop the others, its error
+        //! is written to the corresponding elements of pResultCodes and pErrorMessages.
+        //!
+        //! \param args           - Compiler arguments of every kernel.
+        //! \param pResults       - A pointer to args.Length() arrays where the compiled bytecode will be written.
+        //! \param pResultCodes   - A pointer to args.Length() result codes of individual compilations.
+        //! \param pErrorMessages - A pointer to args.Length() arrays where the UTF-8 compiler output of failed
+        //!                         compilations will be written, can be nullptr to write the errors to the log.
+        //!
+        //! \return ResultCode::Success if all the kernels were compiled or the first error code otherwise.
+        virtual ResultCode CompileBatch(ArraySlice<const KernelCompilerArgs> args, HeapArray<Byte>* pResults,
+                                        ResultCode* pResultCodes, HeapArray<Byte>* pErrorMessages) = 0;
+
+        //! \brief Get reflection data of a compiled kernel.
+        //!
+        //! The returned resource layout can be used to create a resource binding for the kernel without writing the
+        //! layout by hand, see KernelReflection::ResourceLayout.
+        //!
+        //! \param bytecode    - Kernel bytecode returned by Compile().
+        //! \param entryPoint  - Name of the kernel entry point, null to use the first one.
+        //! \param pReflection - A pointer to a structure where the reflection data will be written.
+        //!
+        //! \return ResultCode::Success or an error code.
+        virtual ResultCode Reflect(ArraySlice<const Byte> bytecode, const char* entryPoint, KernelReflection* pReflection) = 0;
     };
 } // namespace UN
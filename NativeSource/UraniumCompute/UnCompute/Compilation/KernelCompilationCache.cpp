@@ -0,0 +1,205 @@
+#include <UnCompute/Compilation/KernelCompilationCache.h>
+#include <UnCompute/Utils/Sha256.h>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+#if UN_WINDOWS
+#    include <process.h>
+#else
+#    include <unistd.h>
+#endif
+
+namespace UN
+{
+    namespace
+    {
+        //! \brief Get a temporary file path unique to the calling writer, so that concurrent threads and processes never
+        //!        write to the same file.
+        std::string GetUniqueTempPath(const std::string& path)
+        {
+#if UN_WINDOWS
+            auto processId = _getpid();
+#else
+            auto processId = getpid();
+#endif
+            std::random_device device;
+            return path + "." + std::to_string(processId) + "." + std::to_string(device()) + ".tmp";
+        }
+    } // namespace
+
+    ResultCode KernelCompilationCache::Init(const KernelCompilationCacheDesc& desc)
+    {
+        m_MemoryCapacity = desc.MemoryCapacity;
+        m_Directory      = desc.Directory ? desc.Directory : "";
+        if (m_Directory.empty())
+        {
+            return ResultCode::Success;
+        }
+
+        std::error_code error;
+        std::filesystem::create_directories(m_Directory, error);
+        if (error)
+        {
+            UN_Error(false, "Couldn't create kernel cache directory \"{}\": {}", m_Directory, error.message());
+            return ResultCode::AccessDenied;
+        }
+
+        return ResultCode::Success;
+    }
+
+    std::string KernelCompilationCache::ComputeKey(const KernelCompilerDesc& compilerDesc, const KernelCompilerArgs& args,
+                                                   std::string_view compilerVersion, std::string_view includeHash)
+    {
+        Sha256 hash;
+        hash.Update(compilerVersion);
+        hash.Update(includeHash);
+        hash.UpdateValue(compilerDesc.SourceLang);
+        hash.UpdateValue(compilerDesc.TargetLang);
+        hash.UpdateValue(compilerDesc.TargetEnv);
+        hash.UpdateValue(compilerDesc.ShaderModel);
+        hash.UpdateValue(static_cast<UInt64>(args.SourceCode.Length()));
+        hash.Update(args.SourceCode);
+        hash.UpdateValue(args.OptimizationLevel);
+        hash.Update(args.EntryPoint ? args.EntryPoint : "");
+        hash.UpdateValue(args.Features);
+        hash.UpdateValue(args.OptimizerFlags);
+
+        // The compiler defines UN_DEBUG depending on the library build configuration.
+#if UN_DEBUG
+        hash.UpdateValue(UInt8{ 1 });
+#else
+        hash.UpdateValue(UInt8{ 0 });
+#endif
+
+        hash.UpdateValue(static_cast<UInt64>(args.Definitions.Length()));
+        for (auto& definition : args.Definitions)
+        {
+            hash.Update(definition.Name ? definition.Name : "");
+            hash.UpdateValue(static_cast<UInt8>(definition.Value != nullptr));
+            hash.Update(definition.Value ? definition.Value : "");
+        }
+
+        return Sha256::ToHex(hash.Finalize());
+    }
+
+    std::string KernelCompilationCache::GetFilePath(std::string_view key) const
+    {
+        return (std::filesystem::path(m_Directory) / (std::string(key) + ".bin")).string();
+    }
+
+    void KernelCompilationCache::PutInMemory(std::string_view key, ArraySlice<const Byte> bytecode)
+    {
+        if (m_MemoryCapacity == 0)
+        {
+            return;
+        }
+
+        if (auto iter = m_EntryMap.find(key); iter != m_EntryMap.end())
+        {
+            m_Entries.splice(m_Entries.begin(), m_Entries, iter->second);
+            return;
+        }
+
+        if (m_Entries.size() >= m_MemoryCapacity)
+        {
+            m_EntryMap.erase(m_Entries.back().Key);
+            m_Entries.pop_back();
+        }
+
+        auto& entry = m_Entries.emplace_front(Entry{ std::string(key), HeapArray<Byte>(bytecode) });
+        m_EntryMap.emplace(entry.Key, m_Entries.begin());
+    }
+
+    bool KernelCompilationCache::TryGet(std::string_view key, HeapArray<Byte>* pResult)
+    {
+        {
+            std::lock_guard lock(m_Mutex);
+            if (auto iter = m_EntryMap.find(key); iter != m_EntryMap.end())
+            {
+                m_Entries.splice(m_Entries.begin(), m_Entries, iter->second);
+                *pResult = iter->second->Bytecode;
+                return true;
+            }
+        }
+
+        if (m_Directory.empty())
+        {
+            return false;
+        }
+
+        // The file is read without the lock, so that lookups of other kernels don't wait for the disk.
+        std::ifstream file(GetFilePath(key), std::ios::binary | std::ios::ate);
+        if (!file)
+        {
+            return false;
+        }
+
+        auto size = static_cast<USize>(file.tellg());
+        if (size == 0)
+        {
+            return false;
+        }
+
+        HeapArray<Byte> bytecode(size);
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char*>(bytecode.Data()), static_cast<std::streamsize>(size)))
+        {
+            UN_Warning(false, "Couldn't read cached kernel \"{}\"", GetFilePath(key));
+            return false;
+        }
+
+        {
+            std::lock_guard lock(m_Mutex);
+            PutInMemory(key, bytecode);
+        }
+
+        *pResult = std::move(bytecode);
+        return true;
+    }
+
+    void KernelCompilationCache::Put(std::string_view key, ArraySlice<const Byte> bytecode)
+    {
+        {
+            std::lock_guard lock(m_Mutex);
+            PutInMemory(key, bytecode);
+        }
+
+        if (m_Directory.empty())
+        {
+            return;
+        }
+
+        // Write to a temporary file of this writer first and rename it, so that a crash or a concurrent writer
+        // never leaves a partial kernel under the final name. The file is written without the lock, so that
+        // lookups don't wait for the disk.
+        auto path     = GetFilePath(key);
+        auto tempPath = GetUniqueTempPath(path);
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(bytecode.Data()), static_cast<std::streamsize>(bytecode.Length()));
+            file.close();
+            if (!file)
+            {
+                UN_Warning(false, "Couldn't write cached kernel \"{}\"", tempPath);
+                std::error_code error;
+                std::filesystem::remove(tempPath, error);
+                return;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(tempPath, path, error);
+        if (error)
+        {
+            UN_Warning(false, "Couldn't store cached kernel \"{}\": {}", path, error.message());
+            std::filesystem::remove(tempPath, error);
+        }
+    }
+
+    USize KernelCompilationCache::GetMemoryEntryCount()
+    {
+        std::lock_guard lock(m_Mutex);
+        return m_Entries.size();
+    }
+} // namespace UN
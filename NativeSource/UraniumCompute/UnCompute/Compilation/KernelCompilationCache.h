@@ -0,0 +1,98 @@
+#pragma once
+#include <UnCompute/Compilation/IKernelCompiler.h>
+#include <UnCompute/Memory/Memory.h>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace UN
+{
+    //! \brief Kernel compilation cache descriptor.
+    struct KernelCompilationCacheDesc
+    {
+        const char* Directory = nullptr; //!< Directory of the persistent cache, null to keep the cache in memory only.
+        UInt32 MemoryCapacity = 64;      //!< Maximum number of kernels kept in memory.
+
+        inline KernelCompilationCacheDesc() = default;
+
+        inline KernelCompilationCacheDesc(const char* directory, UInt32 memoryCapacity)
+            : Directory(directory)
+            , MemoryCapacity(memoryCapacity)
+        {
+        }
+    };
+
+    //! \brief Content-addressed cache of compiled kernels.
+    //!
+    //! The bytecode is stored by a SHA-256 key of all the compilation inputs, see ComputeKey(). Recently used kernels
+    //! are kept in memory, the least recently used ones are evicted when the capacity is exceeded. If a directory is
+    //! specified, every kernel is also stored in a file named after its key, so that the cache survives restarts.
+    //!
+    //! All the methods are thread-safe, multiple processes can share the same cache directory.
+    class KernelCompilationCache final : public Object<IObject>
+    {
+        struct Entry
+        {
+            std::string Key;
+            HeapArray<Byte> Bytecode;
+        };
+
+        std::mutex m_Mutex;
+        std::list<Entry> m_Entries; //!< Kernels in memory, the most recently used first.
+        std::unordered_map<std::string_view, std::list<Entry>::iterator> m_EntryMap;
+
+        std::string m_Directory;
+        UInt32 m_MemoryCapacity = 0;
+
+        [[nodiscard]] std::string GetFilePath(std::string_view key) const;
+        void PutInMemory(std::string_view key, ArraySlice<const Byte> bytecode);
+
+    public:
+        inline KernelCompilationCache() = default;
+        ~KernelCompilationCache() override = default;
+
+        //! \brief Initialize the cache, creates the cache directory if it doesn't exist.
+        //!
+        //! \param desc - Cache descriptor.
+        //!
+        //! \return ResultCode::Success or an error code.
+        ResultCode Init(const KernelCompilationCacheDesc& desc);
+
+        //! \brief Compute a cache key for a compilation.
+        //!
+        //! \param compilerDesc    - Descriptor of the compiler that compiles the kernel.
+        //! \param args            - Compilation arguments.
+        //! \param compilerVersion - Version of the underlying compiler, so that its updates invalidate the cache.
+        //! \param includeHash     - Hash of the headers available to the kernel, see KernelIncludeRegistry::GetHash().
+        //!
+        //! \return A hexadecimal SHA-256 hash of the compilation inputs.
+        static std::string ComputeKey(const KernelCompilerDesc& compilerDesc, const KernelCompilerArgs& args,
+                                      std::string_view compilerVersion, std::string_view includeHash = {});
+
+        //! \brief Find a compiled kernel in memory or on disk.
+        //!
+        //! \param key     - The key returned by ComputeKey().
+        //! \param pResult - A pointer to an array where the cached bytecode will be written.
+        //!
+        //! \return True if the kernel was found.
+        bool TryGet(std::string_view key, HeapArray<Byte>* pResult);
+
+        //! \brief Store a compiled kernel in memory and on disk.
+        //!
+        //! \param key      - The key returned by ComputeKey().
+        //! \param bytecode - Compiled kernel bytecode.
+        void Put(std::string_view key, ArraySlice<const Byte> bytecode);
+
+        //! \brief Get the number of kernels currently kept in memory.
+        [[nodiscard]] USize GetMemoryEntryCount();
+
+        inline static ResultCode Create(KernelCompilationCache** ppCache)
+        {
+            *ppCache = AllocateObject<KernelCompilationCache>();
+            (*ppCache)->AddRef();
+            return ResultCode::Success;
+        }
+    };
+} // namespace UN
@@ -3,6 +3,8 @@
 
 #include <dxc/DxilContainer/DxilContainer.h>
 #include <dxc/dxcapi.h>
+#include <algorithm>
+#include <thread>
 
 namespace UN
 {
@@ -32,10 +34,61 @@ namespace UN
         }
     }
 
-    inline LPCWSTR GetTargetProfile(KernelSourceLang lang)
+    inline bool Uses16BitTypes(DeviceFeatureFlags features)
+    {
+        constexpr auto flags16Bit = DeviceFeatureFlags::Float16 | DeviceFeatureFlags::Int16 | DeviceFeatureFlags::Storage16Bit;
+        return AnyFlagsActive(features, flags16Bit);
+    }
+
+    inline LPCWSTR GetTargetProfile(KernelSourceLang lang, KernelShaderModel shaderModel, DeviceFeatureFlags features)
     {
         UN_Verify(lang == KernelSourceLang::Hlsl, "Kernel source language {} is not supported", static_cast<Int32>(lang));
-        return L"cs_6_0";
+
+        if (AllFlagsActive(features, DeviceFeatureFlags::Int64Atomics))
+        {
+            shaderModel = std::max(shaderModel, KernelShaderModel::SM6_6);
+        }
+        if (Uses16BitTypes(features))
+        {
+            shaderModel = std::max(shaderModel, KernelShaderModel::SM6_2);
+        }
+
+        switch (shaderModel)
+        {
+        case KernelShaderModel::SM6_0:
+            return L"cs_6_0";
+        case KernelShaderModel::SM6_1:
+            return L"cs_6_1";
+        case KernelShaderModel::SM6_2:
+            return L"cs_6_2";
+        case KernelShaderModel::SM6_3:
+            return L"cs_6_3";
+        case KernelShaderModel::SM6_4:
+            return L"cs_6_4";
+        case KernelShaderModel::SM6_5:
+            return L"cs_6_5";
+        case KernelShaderModel::SM6_6:
+            return L"cs_6_6";
+        default:
+            UN_Error(false, "Unknown KernelShaderModel::<{}>", static_cast<Int32>(shaderModel));
+            return nullptr;
+        }
+    }
+
+    inline LPCWSTR ConvertTargetEnv(KernelTargetEnv targetEnv)
+    {
+        switch (targetEnv)
+        {
+        case KernelTargetEnv::Vulkan1_1:
+            return L"-fspv-target-env=vulkan1.1";
+        case KernelTargetEnv::Vulkan1_2:
+            return L"-fspv-target-env=vulkan1.2";
+        case KernelTargetEnv::Vulkan1_3:
+            return L"-fspv-target-env=vulkan1.3";
+        default:
+            UN_Error(false, "Unknown KernelTargetEnv::<{}>", static_cast<Int32>(targetEnv));
+            return nullptr;
+        }
     }
 
     inline LPCWSTR ConvertOptLevel(CompilerOptimizationLevel level)
@@ -56,20 +109,110 @@ namespace UN
         }
     }
 
+    //! \brief Get the value of DXC -Oconfig argument, an empty string to use the default optimizer passes.
+    inline std::wstring GetSpirVOptimizerConfig(CompilerOptimizationLevel level, SpirVOptimizerFlags flags)
+    {
+        // -Oconfig can't be combined with -Od, and -Od disables the SPIR-V optimizer anyway.
+        if (flags == SpirVOptimizerFlags::None || level == CompilerOptimizationLevel::None)
+        {
+            return {};
+        }
+
+        // -Oconfig replaces the passes selected by the optimization level, so the recipe is added explicitly.
+        std::vector<std::wstring> passes;
+        if (AllFlagsActive(flags, SpirVOptimizerFlags::OptimizeSize))
+        {
+            passes.emplace_back(L"-Os");
+        }
+        else
+        {
+            passes.emplace_back(L"-O");
+        }
+
+        if (AllFlagsActive(flags, SpirVOptimizerFlags::StripDebugInfo))
+        {
+            passes.emplace_back(L"--strip-debug");
+            passes.emplace_back(L"--strip-nonsemantic");
+        }
+
+        if (AllFlagsActive(flags, SpirVOptimizerFlags::CompactIds))
+        {
+            passes.emplace_back(L"--compact-ids");
+        }
+
+        std::wstring result = L"-Oconfig=";
+        for (USize i = 0; i < passes.size(); ++i)
+        {
+            result += i == 0 ? L"" : L",";
+            result += passes[i];
+        }
+
+        return result;
+    }
+
+    inline std::string ConvertToUtf8(LPCWSTR pString)
+    {
+        std::string result;
+        for (; *pString; ++pString)
+        {
+            auto codePoint = static_cast<UInt32>(*pString);
+            if constexpr (sizeof(wchar_t) == 2)
+            {
+                if (codePoint >= 0xD800 && codePoint < 0xDC00 && pString[1] >= 0xDC00 && pString[1] < 0xE000)
+                {
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (static_cast<UInt32>(*++pString) - 0xDC00);
+                }
+            }
+
+            if (codePoint < 0x80)
+            {
+                result += static_cast<char>(codePoint);
+            }
+            else if (codePoint < 0x800)
+            {
+                result += static_cast<char>(0xC0 | (codePoint >> 6));
+                result += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            else if (codePoint < 0x10000)
+            {
+                result += static_cast<char>(0xE0 | (codePoint >> 12));
+                result += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                result += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            else
+            {
+                result += static_cast<char>(0xF0 | (codePoint >> 18));
+                result += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                result += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                result += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+        }
+
+        return result;
+    }
+
+    //! \brief Resolves `#include` directives using the headers registered in a KernelIncludeRegistry.
     class IncludeHandler : public IDxcIncludeHandler
     {
         std::atomic_int m_RefCounter;
-        std::wstring m_BasePath;
-        IDxcLibrary* m_Library;
+        IDxcUtils* m_pUtils;
+        KernelIncludeRegistry* m_pIncludes;
+        bool m_ReadFromDisk = false;
 
     public:
-        inline IncludeHandler(const std::wstring& basePath, IDxcLibrary* library)
+        inline IncludeHandler(IDxcUtils* pUtils, KernelIncludeRegistry* pIncludes)
             : m_RefCounter(0)
-            , m_BasePath(basePath)
-            , m_Library(library)
+            , m_pUtils(pUtils)
+            , m_pIncludes(pIncludes)
         {
         }
 
+        //! \brief True if at least one header was not registered and was read from disk.
+        [[nodiscard]] inline bool ReadFromDisk() const
+        {
+            return m_ReadFromDisk;
+        }
+
         inline HRESULT QueryInterface(const IID&, void**) override
         {
             return E_FAIL;
@@ -87,17 +230,44 @@ namespace UN
 
         inline HRESULT LoadSource(LPCWSTR pFilename, IDxcBlob** ppIncludeSource) override
         {
-            UN_Error(false, "HLSL Include handler is not implemented");
-            auto path = m_BasePath + pFilename;
-            CComPtr<IDxcBlobEncoding> source;
-            HRESULT result = m_Library->CreateBlobFromFile(path.c_str(), nullptr, &source);
+            // DXC looks an include up in several directories, so a miss is not an error. If the file can't be found
+            // at all, the compilation fails and the compiler output names the missing include.
+            CComPtr<IDxcBlobEncoding> blob;
+            HRESULT result;
+            ArraySlice<const Byte> source;
+            if (m_pIncludes->TryGet(ConvertToUtf8(pFilename), &source))
+            {
+                // The registry never frees the sources, so the blob can reference them without a copy.
+                auto size = static_cast<UInt32>(source.Length());
+                result    = m_pUtils->CreateBlobFromPinned(source.Data(), size, DXC_CP_UTF8, &blob);
+            }
+            else
+            {
+                // Headers that were not registered are read from disk. Their contents are not a part of the cache key,
+                // so the kernels that include them are never cached.
+                result         = m_pUtils->LoadFile(pFilename, nullptr, &blob);
+                m_ReadFromDisk = m_ReadFromDisk || SUCCEEDED(result);
+            }
 
             if (SUCCEEDED(result) && ppIncludeSource)
-                *ppIncludeSource = source.Detach();
+                *ppIncludeSource = blob.Detach();
             return result;
         }
     };
 
+    struct KernelCompiler::DxcContext
+    {
+        CComPtr<IDxcUtils> pUtils;
+        CComPtr<IDxcCompiler3> pCompiler;
+    };
+
+    KernelCompiler::KernelCompiler() = default;
+
+    KernelCompiler::~KernelCompiler()
+    {
+        StopWorkers();
+    }
+
     const IKernelCompiler::DescriptorType& KernelCompiler::GetDesc() const
     {
         return m_Desc;
@@ -115,99 +285,354 @@ namespace UN
             return resultCode;
         }
 
-        return ResultCode::Success;
+        // Create the first context right away, so that the errors are reported on initialization.
+        std::unique_ptr<DxcContext> context;
+        if (auto resultCode = AcquireContext(context); Failed(resultCode))
+        {
+            return resultCode;
+        }
+
+        ReleaseContext(std::move(context));
+
+        UN_VerifyResultFatal(KernelIncludeRegistry::Create(&m_pIncludes), "Couldn't create KernelIncludeRegistry object");
+
+        if (m_Desc.MemoryCacheCapacity == 0 && m_Desc.CacheDirectory == nullptr)
+        {
+            return ResultCode::Success;
+        }
+
+        m_CompilerVersion = GetCompilerVersion();
+        UN_VerifyResultFatal(KernelCompilationCache::Create(&m_pCache), "Couldn't create KernelCompilationCache object");
+        return m_pCache->Init(KernelCompilationCacheDesc(m_Desc.CacheDirectory, m_Desc.MemoryCacheCapacity));
     }
 
-    ResultCode KernelCompiler::Compile(const KernelCompilerArgs& args, HeapArray<Byte>* pResult)
+    ResultCode KernelCompiler::AcquireContext(std::unique_ptr<DxcContext>& context)
     {
+        {
+            std::lock_guard lock(m_ContextMutex);
+            if (!m_FreeContexts.empty())
+            {
+                context = std::move(m_FreeContexts.back());
+                m_FreeContexts.pop_back();
+                return ResultCode::Success;
+            }
+        }
+
         DxcCreateInstanceProc createInstance{};
         UN_VerifyResultFatal(m_DynamicLibrary->GetFunction("DxcCreateInstance", &createInstance),
                              "Couldn't find DxcCreateInstance()");
 
-        CComPtr<IDxcLibrary> pLibrary;
-        HRESULT result = createInstance(CLSID_DxcLibrary, IID_PPV_ARGS(&pLibrary));
+        auto newContext = std::make_unique<DxcContext>();
+        HRESULT result  = createInstance(CLSID_DxcUtils, IID_PPV_ARGS(&newContext->pUtils));
         if (FAILED(result))
         {
-            UN_Error(false, "Couldn't create a DXC library");
+            UN_Error(false, "Couldn't create DXC utils");
             return ConvertResult(result);
         }
 
-        CComPtr<IDxcCompiler> pCompiler;
-        result = createInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&pCompiler));
+        result = createInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&newContext->pCompiler));
         if (FAILED(result))
         {
             UN_Error(false, "Couldn't create a DXC compiler");
             return ConvertResult(result);
         }
 
-        CComPtr<IDxcBlobEncoding> source;
-        auto sourceSize = static_cast<UInt32>(args.SourceCode.Length());
-        result          = pLibrary->CreateBlobWithEncodingFromPinned(args.SourceCode.Data(), sourceSize, CP_UTF8, &source);
-        if (FAILED(result))
+        context = std::move(newContext);
+        return ResultCode::Success;
+    }
+
+    void KernelCompiler::ReleaseContext(std::unique_ptr<DxcContext> context)
+    {
+        std::lock_guard lock(m_ContextMutex);
+        m_FreeContexts.push_back(std::move(context));
+    }
+
+    std::string KernelCompiler::GetCompilerVersion()
+    {
+        std::unique_ptr<DxcContext> context;
+        if (Failed(AcquireContext(context)))
         {
-            UN_Error(false, "Couldn't create a DXC Blob encoding");
-            return ConvertResult(result);
+            return "dxc unknown";
         }
 
-        IncludeHandler includeHandler(L"", pLibrary);
+        std::string result = "dxc";
+        CComPtr<IDxcVersionInfo> pVersionInfo;
+        UINT32 major = 0, minor = 0;
+        if (SUCCEEDED(context->pCompiler.QueryInterface(&pVersionInfo))
+            && SUCCEEDED(pVersionInfo->GetVersion(&major, &minor)))
+        {
+            result += " " + std::to_string(major) + "." + std::to_string(minor);
+        }
 
-        std::vector<DxcDefine> defines;
+        CComPtr<IDxcVersionInfo2> pVersionInfo2;
+        UINT32 commitCount = 0;
+        char* pCommitHash  = nullptr;
+        if (SUCCEEDED(context->pCompiler.QueryInterface(&pVersionInfo2))
+            && SUCCEEDED(pVersionInfo2->GetCommitInfo(&commitCount, &pCommitHash)))
+        {
+            result += " " + std::to_string(commitCount) + " " + pCommitHash;
+            CoTaskMemFree(pCommitHash);
+        }
 
-#if UN_DEBUG
-        defines.push_back(DxcDefine{ L"UN_DEBUG", L"1" });
+        ReleaseContext(std::move(context));
+        return result;
+    }
 
+    USize KernelCompiler::StartWorkers()
+    {
+        std::lock_guard lock(m_WorkerMutex);
+        if (m_Workers.empty())
+        {
+            // The calling thread compiles kernels too, so it is counted as one of the workers.
+            auto hardwareThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+            for (UInt32 i = 1; i < hardwareThreadCount; ++i)
+            {
+                m_Workers.emplace_back(&KernelCompiler::RunWorker, this);
+            }
+        }
+
+        return m_Workers.size();
+    }
+
+    void KernelCompiler::StopWorkers()
+    {
+        {
+            std::lock_guard lock(m_WorkerMutex);
+            m_StopWorkers = true;
+        }
+
+        m_WorkerCondition.notify_all();
+        for (auto& worker : m_Workers)
+        {
+            worker.join();
+        }
+
+        m_Workers.clear();
+    }
+
+    void KernelCompiler::RunWorker()
+    {
+        std::unique_lock lock(m_WorkerMutex);
+        while (true)
+        {
+            m_WorkerCondition.wait(lock, [this] {
+                return m_StopWorkers || !m_WorkerTasks.empty();
+            });
+
+            if (m_WorkerTasks.empty())
+            {
+                return;
+            }
+
+            auto task = std::move(m_WorkerTasks.front());
+            m_WorkerTasks.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+    ResultCode KernelCompiler::Compile(const KernelCompilerArgs& args, HeapArray<Byte>* pResult)
+    {
+        return CompileCached(args, pResult, nullptr);
+    }
+
+    ResultCode KernelCompiler::CompileCached(const KernelCompilerArgs& args, HeapArray<Byte>* pResult,
+                                             HeapArray<Byte>* pErrorMessage)
+    {
+        if (!m_pCache)
+        {
+            return CompileInternal(args, pResult, pErrorMessage, nullptr);
+        }
+
+        auto key = KernelCompilationCache::ComputeKey(m_Desc, args, m_CompilerVersion, m_pIncludes->GetHash());
+        if (m_pCache->TryGet(key, pResult))
+        {
+            return ResultCode::Success;
+        }
+
+        bool readDiskIncludes = false;
+        auto result           = CompileInternal(args, pResult, pErrorMessage, &readDiskIncludes);
+        if (Succeeded(result) && !readDiskIncludes)
+        {
+            m_pCache->Put(key, *pResult);
+        }
+
+        return result;
+    }
+
+    ResultCode KernelCompiler::RegisterInclude(const char* name, ArraySlice<const Byte> source)
+    {
+        return m_pIncludes->Register(name, source);
+    }
+
+    ResultCode KernelCompiler::RegisterIncludeFile(const char* name, const char* path)
+    {
+        return m_pIncludes->RegisterFile(name, path);
+    }
+
+    ResultCode KernelCompiler::CompileBatch(ArraySlice<const KernelCompilerArgs> args, HeapArray<Byte>* pResults,
+                                            ResultCode* pResultCodes, HeapArray<Byte>* pErrorMessages)
+    {
+        std::atomic<USize> nextIndex = 0;
+        auto compileKernels          = [&]() {
+            for (USize i = nextIndex++; i < args.Length(); i = nextIndex++)
+            {
+                auto* pErrorMessage = pErrorMessages ? &pErrorMessages[i] : nullptr;
+                pResultCodes[i]     = CompileCached(args[i], &pResults[i], pErrorMessage);
+            }
+        };
+
+        std::mutex batchMutex;
+        std::condition_variable batchCondition;
+        auto helperCount   = args.Empty() ? 0 : std::min(StartWorkers(), args.Length() - 1);
+        auto runningCount  = helperCount;
+        auto compileHelper = [&]() {
+            compileKernels();
+
+            // Notify under the lock, the condition variable is destroyed as soon as the caller sees zero.
+            std::lock_guard lock(batchMutex);
+            --runningCount;
+            batchCondition.notify_one();
+        };
+
+        {
+            std::lock_guard lock(m_WorkerMutex);
+            for (USize i = 0; i < helperCount; ++i)
+            {
+                m_WorkerTasks.emplace_back(compileHelper);
+            }
+        }
+
+        m_WorkerCondition.notify_all();
+        compileKernels();
+
+        {
+            std::unique_lock lock(batchMutex);
+            batchCondition.wait(lock, [&] {
+                return runningCount == 0;
+            });
+        }
+
+        for (USize i = 0; i < args.Length(); ++i)
+        {
+            if (Failed(pResultCodes[i]))
+            {
+                return pResultCodes[i];
+            }
+        }
+
+        return ResultCode::Success;
+    }
+
+    ResultCode KernelCompiler::Reflect(ArraySlice<const Byte> bytecode, const char* entryPoint, KernelReflection* pReflection)
+    {
+        switch (m_Desc.TargetLang)
+        {
+        case KernelTargetLang::SpirV:
+            return KernelReflection::FromSpirV(bytecode, entryPoint, pReflection);
+        default:
+            UN_Error(false, "Unknown KernelTargetLang::<{}>", static_cast<Int32>(m_Desc.TargetLang));
+            return ResultCode::InvalidArguments;
+        }
+    }
+
+    ResultCode KernelCompiler::CompileInternal(const KernelCompilerArgs& args, HeapArray<Byte>* pResult,
+                                               HeapArray<Byte>* pErrorMessage, bool* pReadDiskIncludes)
+    {
+        std::unique_ptr<DxcContext> context;
+        if (auto result = AcquireContext(context); Failed(result))
+        {
+            return result;
+        }
+
+        auto result = CompileWithContext(*context, args, pResult, pErrorMessage, pReadDiskIncludes);
+        ReleaseContext(std::move(context));
+        return result;
+    }
+
+    ResultCode KernelCompiler::CompileWithContext(DxcContext& context, const KernelCompilerArgs& args,
+                                                  HeapArray<Byte>* pResult, HeapArray<Byte>* pErrorMessage,
+                                                  bool* pReadDiskIncludes)
+    {
+        DxcBuffer source{};
+        source.Ptr      = args.SourceCode.Data();
+        source.Size     = args.SourceCode.Length();
+        source.Encoding = DXC_CP_UTF8;
+
+        IncludeHandler includeHandler(context.pUtils, m_pIncludes.Get());
+
+        // All the strings are stored before the argument pointers are taken, so that they're never reallocated.
+        std::vector<std::wstring> argStrings;
+        argStrings.reserve(args.Definitions.Length() + 2);
+        argStrings.emplace_back(args.EntryPoint, args.EntryPoint + strlen(args.EntryPoint));
+
+#if UN_DEBUG
+        argStrings.emplace_back(L"UN_DEBUG=1");
 #else
-        defines.push_back(DxcDefine{ L"UN_DEBUG", L"0" });
+        argStrings.emplace_back(L"UN_DEBUG=0");
 #endif
 
-        std::vector<std::wstring> defineWStrings;
-        for (auto define : args.Definitions)
+        for (auto& define : args.Definitions)
         {
-            defineWStrings.emplace_back(define.Name, define.Name + strlen(define.Name));
-            defineWStrings.emplace_back(define.Value, define.Value + strlen(define.Value));
+            auto& defineString = argStrings.emplace_back(define.Name, define.Name + strlen(define.Name));
+            if (define.Value)
+            {
+                defineString += L'=';
+                defineString.append(define.Value, define.Value + strlen(define.Value));
+            }
         }
 
-        for (USize i = 0; i < args.Definitions.Length(); ++i)
+        std::vector<LPCWSTR> compileArgs = {
+            L"KernelComputeShader",
+            L"-E",
+            argStrings[0].c_str(),
+            L"-T",
+            GetTargetProfile(m_Desc.SourceLang, m_Desc.ShaderModel, args.Features),
+            DXC_ARG_PACK_MATRIX_COLUMN_MAJOR,
+        };
+
+        // DXC doesn't allow -Oconfig together with an optimization level.
+        std::wstring optimizerConfig;
+        if (m_Desc.TargetLang == KernelTargetLang::SpirV)
         {
-            LPCWSTR name  = defineWStrings[i * 2].c_str();
-            LPCWSTR value = defineWStrings[i * 2 + 1].c_str();
-            defines.push_back(DxcDefine{ name, value });
+            optimizerConfig = GetSpirVOptimizerConfig(args.OptimizationLevel, args.OptimizerFlags);
         }
 
-        auto defineCount = static_cast<UInt32>(defines.size());
+        compileArgs.push_back(optimizerConfig.empty() ? ConvertOptLevel(args.OptimizationLevel) : optimizerConfig.c_str());
+
+        for (USize i = 1; i < argStrings.size(); ++i)
+        {
+            compileArgs.push_back(L"-D");
+            compileArgs.push_back(argStrings[i].c_str());
+        }
 
-        std::vector<LPCWSTR> compileArgs;
         if (m_Desc.TargetLang == KernelTargetLang::SpirV)
         {
-            compileArgs.assign({
-                ConvertOptLevel(args.OptimizationLevel),
-                DXC_ARG_PACK_MATRIX_COLUMN_MAJOR,
-                L"-spirv",
-                L"-fspv-target-env=vulkan1.1",
-                L"-fspv-extension=KHR",
-                //L"-fspv-extension=SPV_GOOGLE_hlsl_functionality1",
-                L"-fspv-extension=SPV_GOOGLE_user_type",
-                L"-fvk-use-dx-layout",
-                L"-fspv-extension=SPV_EXT_descriptor_indexing",
-                //L"-fspv-reflect"
-            });
+            compileArgs.insert(compileArgs.end(),
+                               {
+                                   L"-spirv",
+                                   ConvertTargetEnv(m_Desc.TargetEnv),
+                                   L"-fspv-extension=KHR",
+                                   //L"-fspv-extension=SPV_GOOGLE_hlsl_functionality1",
+                                   L"-fspv-extension=SPV_GOOGLE_user_type",
+                                   L"-fvk-use-dx-layout",
+                                   L"-fspv-extension=SPV_EXT_descriptor_indexing",
+                                   //L"-fspv-reflect"
+                               });
         }
 
-        auto argsCount = static_cast<UInt32>(compileArgs.size());
+        if (Uses16BitTypes(args.Features))
+        {
+            compileArgs.push_back(L"-enable-16bit-types");
+        }
 
-        auto entryPoint = std::wstring(args.EntryPoint, args.EntryPoint + strlen(args.EntryPoint));
-        auto profile    = GetTargetProfile(m_Desc.SourceLang);
-        CComPtr<IDxcOperationResult> compileResult;
-        result = pCompiler->Compile(source,
-                                    L"KernelComputeShader",
-                                    entryPoint.c_str(),
-                                    profile,
-                                    compileArgs.data(),
-                                    argsCount,
-                                    defines.data(),
-                                    defineCount,
-                                    &includeHandler,
-                                    &compileResult);
+        CComPtr<IDxcResult> compileResult;
+        HRESULT result = context.pCompiler->Compile(&source,
+                                                    compileArgs.data(),
+                                                    static_cast<UInt32>(compileArgs.size()),
+                                                    &includeHandler,
+                                                    IID_PPV_ARGS(&compileResult));
 
         if (SUCCEEDED(result))
         {
@@ -218,22 +643,35 @@ namespace UN
             }
         }
 
+        if (pReadDiskIncludes)
+        {
+            *pReadDiskIncludes = includeHandler.ReadFromDisk();
+        }
+
         if (SUCCEEDED(result))
         {
             CComPtr<IDxcBlob> pByteCode;
-            UN_Verify(SUCCEEDED(compileResult->GetResult(&pByteCode)), "Couldn't get compilation result");
+            UN_Verify(SUCCEEDED(compileResult->GetOutput(DXC_OUT_OBJECT, IID_PPV_ARGS(&pByteCode), nullptr)),
+                      "Couldn't get compilation result");
             auto pBuffer = static_cast<Byte*>(pByteCode->GetBufferPointer());
             *pResult     = HeapArray<Byte>::CopyFrom(ArraySlice(pBuffer, pBuffer + pByteCode->GetBufferSize()));
             return ResultCode::Success;
         }
         else
         {
-            CComPtr<IDxcBlobEncoding> errors;
-            CComPtr<IDxcBlobEncoding> unicodeErrors;
-            if (SUCCEEDED(compileResult->GetErrorBuffer(&errors)) && SUCCEEDED(pLibrary->GetBlobAsUtf8(errors, &unicodeErrors)))
+            CComPtr<IDxcBlobUtf8> errors;
+            if (compileResult && SUCCEEDED(compileResult->GetOutput(DXC_OUT_ERRORS, IID_PPV_ARGS(&errors), nullptr))
+                && errors && errors->GetStringLength() > 0)
             {
-                auto errorString = static_cast<const char*>(unicodeErrors->GetBufferPointer());
-                UN_VerifyError(false, "Shader compilation failed: {}", errorString);
+                if (pErrorMessage)
+                {
+                    auto pErrors   = reinterpret_cast<const Byte*>(errors->GetStringPointer());
+                    *pErrorMessage = HeapArray<Byte>::CopyFrom(ArraySlice(pErrors, pErrors + errors->GetStringLength()));
+                }
+                else
+                {
+                    UN_VerifyError(false, "Shader compilation failed: {}", errors->GetStringPointer());
+                }
             }
 
             return ConvertResult(result);
@@ -1,6 +1,15 @@
 #pragma once
 #include <UnCompute/Compilation/IKernelCompiler.h>
+#include <UnCompute/Compilation/KernelCompilationCache.h>
+#include <UnCompute/Compilation/KernelIncludeRegistry.h>
 #include <UnCompute/Memory/Ptr.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace UN
 {
@@ -8,15 +17,53 @@ namespace UN
 
     class KernelCompiler final : public Object<IKernelCompiler>
     {
+        //! \brief DXC utils and compiler instances, created once and reused by the following compilations.
+        struct DxcContext;
+
         Ptr<DynamicLibrary> m_DynamicLibrary;
+        Ptr<KernelCompilationCache> m_pCache;
+        Ptr<KernelIncludeRegistry> m_pIncludes;
         DescriptorType m_Desc;
+        std::string m_CompilerVersion;
+
+        // DXC compiler instances are not thread-safe, so every thread that compiles at the same time takes its own
+        // context from the pool and returns it afterwards.
+        std::mutex m_ContextMutex;
+        std::vector<std::unique_ptr<DxcContext>> m_FreeContexts;
+
+        // Worker threads of CompileBatch(), started by the first batch and reused by the following ones.
+        std::mutex m_WorkerMutex;
+        std::condition_variable m_WorkerCondition;
+        std::deque<std::function<void()>> m_WorkerTasks;
+        std::vector<std::thread> m_Workers;
+        bool m_StopWorkers = false;
+
+        ResultCode AcquireContext(std::unique_ptr<DxcContext>& context);
+        void ReleaseContext(std::unique_ptr<DxcContext> context);
+
+        USize StartWorkers();
+        void StopWorkers();
+        void RunWorker();
+
+        std::string GetCompilerVersion();
+        ResultCode CompileCached(const KernelCompilerArgs& args, HeapArray<Byte>* pResult, HeapArray<Byte>* pErrorMessage);
+        ResultCode CompileInternal(const KernelCompilerArgs& args, HeapArray<Byte>* pResult, HeapArray<Byte>* pErrorMessage,
+                                   bool* pReadDiskIncludes);
+        ResultCode CompileWithContext(DxcContext& context, const KernelCompilerArgs& args, HeapArray<Byte>* pResult,
+                                      HeapArray<Byte>* pErrorMessage, bool* pReadDiskIncludes);
 
     public:
-        ~KernelCompiler() override = default;
+        KernelCompiler();
+        ~KernelCompiler() override;
 
     private:
         [[nodiscard]] const DescriptorType& GetDesc() const override;
         ResultCode Init(const DescriptorType& desc) override;
         ResultCode Compile(const KernelCompilerArgs& args, HeapArray<Byte>* pResult) override;
+        ResultCode RegisterInclude(const char* name, ArraySlice<const Byte> source) override;
+        ResultCode RegisterIncludeFile(const char* name, const char* path) override;
+        ResultCode CompileBatch(ArraySlice<const KernelCompilerArgs> args, HeapArray<Byte>* pResults, ResultCode* pResultCodes,
+                                HeapArray<Byte>* pErrorMessages) override;
+        ResultCode Reflect(ArraySlice<const Byte> bytecode, const char* entryPoint, KernelReflection* pReflection) override;
     };
 } // namespace UN
@@ -0,0 +1,113 @@
+#include <UnCompute/Compilation/KernelIncludeRegistry.h>
+#include <UnCompute/Utils/Sha256.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace UN
+{
+    std::string KernelIncludeRegistry::NormalizeName(std::string_view name)
+    {
+        std::string result(name);
+        std::replace(result.begin(), result.end(), '\\', '/');
+
+        // DXC prepends "./" to the names of the files included with quotes, and relative includes from nested headers
+        // can contain "./" and "../" in the middle.
+        return std::filesystem::path(result).lexically_normal().generic_string();
+    }
+
+    void KernelIncludeRegistry::UpdateHash()
+    {
+        std::vector<const std::string*> names;
+        names.reserve(m_Includes.size());
+        for (auto& [name, source] : m_Includes)
+        {
+            names.push_back(&name);
+        }
+
+        std::sort(names.begin(), names.end(), [](const std::string* lhs, const std::string* rhs) {
+            return *lhs < *rhs;
+        });
+
+        Sha256 hash;
+        for (auto* pName : names)
+        {
+            auto& source = m_Includes.at(*pName);
+            hash.Update(*pName);
+            hash.UpdateValue(static_cast<UInt64>(source.Length()));
+            hash.Update(source);
+        }
+
+        m_Hash = Sha256::ToHex(hash.Finalize());
+    }
+
+    ResultCode KernelIncludeRegistry::Register(std::string_view name, ArraySlice<const Byte> source)
+    {
+        auto key = NormalizeName(name);
+
+        std::lock_guard lock(m_Mutex);
+        if (auto iter = m_Includes.find(key); iter != m_Includes.end())
+        {
+            auto& existing = iter->second;
+            if (existing.Length() == source.Length() && std::equal(source.begin(), source.end(), existing.begin()))
+            {
+                return ResultCode::Success;
+            }
+
+            UN_Error(false, "Kernel include \"{}\" has already been registered with different source code", key);
+            return ResultCode::InvalidArguments;
+        }
+
+        m_Includes.emplace(std::move(key), HeapArray<Byte>(source));
+        UpdateHash();
+        return ResultCode::Success;
+    }
+
+    ResultCode KernelIncludeRegistry::RegisterFile(std::string_view name, const char* path)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file)
+        {
+            UN_Error(false, "Couldn't open kernel include file \"{}\"", path);
+            return ResultCode::AccessDenied;
+        }
+
+        auto size = static_cast<USize>(file.tellg());
+        HeapArray<Byte> source(size);
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char*>(source.Data()), static_cast<std::streamsize>(size)))
+        {
+            UN_Error(false, "Couldn't read kernel include file \"{}\"", path);
+            return ResultCode::Fail;
+        }
+
+        return Register(name, source);
+    }
+
+    bool KernelIncludeRegistry::TryGet(std::string_view name, ArraySlice<const Byte>* pSource)
+    {
+        auto key = NormalizeName(name);
+
+        std::lock_guard lock(m_Mutex);
+        if (auto iter = m_Includes.find(key); iter != m_Includes.end())
+        {
+            *pSource = iter->second;
+            return true;
+        }
+
+        return false;
+    }
+
+    std::string KernelIncludeRegistry::GetHash()
+    {
+        std::lock_guard lock(m_Mutex);
+        return m_Hash;
+    }
+
+    USize KernelIncludeRegistry::GetIncludeCount()
+    {
+        std::lock_guard lock(m_Mutex);
+        return m_Includes.size();
+    }
+} // namespace UN
@@ -0,0 +1,76 @@
+#pragma once
+#include <UnCompute/Base/Byte.h>
+#include <UnCompute/Containers/HeapArray.h>
+#include <UnCompute/Memory/Memory.h>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace UN
+{
+    //! \brief In-memory file system of the headers that can be included by kernel sources.
+    //!
+    //! Shared headers are registered once from memory or from disk and then reused by every compilation without reading
+    //! them again. The registered sources are never moved or removed, so the compiler can reference them directly.
+    //! The hash of all the registered headers is a part of the compilation cache key, see GetHash().
+    //!
+    //! All the methods are thread-safe.
+    class KernelIncludeRegistry final : public Object<IObject>
+    {
+        std::mutex m_Mutex;
+        std::unordered_map<std::string, HeapArray<Byte>> m_Includes;
+        std::string m_Hash;
+
+        void UpdateHash();
+
+    public:
+        inline KernelIncludeRegistry() = default;
+        ~KernelIncludeRegistry() override = default;
+
+        //! \brief Convert an include name to the form used as a key, e.g. `.\Math\Random.hlsl` to `Math/Random.hlsl`.
+        //!
+        //! The `.` and `..` elements are resolved lexically, so `Math/../Common.hlsl` is the same as `Common.hlsl`.
+        static std::string NormalizeName(std::string_view name);
+
+        //! \brief Register a header from memory, the source code is copied.
+        //!
+        //! Registering the same source under the same name again is allowed and does nothing.
+        //!
+        //! \param name   - The name used in `#include "name"` directives.
+        //! \param source - The source code of the header.
+        //!
+        //! \return ResultCode::Success or ResultCode::InvalidArguments if a different header has the same name.
+        ResultCode Register(std::string_view name, ArraySlice<const Byte> source);
+
+        //! \brief Read a header from disk and register it.
+        //!
+        //! \param name - The name used in `#include "name"` directives.
+        //! \param path - Path to the header file.
+        //!
+        //! \return ResultCode::Success or an error code.
+        ResultCode RegisterFile(std::string_view name, const char* path);
+
+        //! \brief Find a registered header.
+        //!
+        //! \param name    - The name used in `#include "name"` directives, it doesn't have to be normalized.
+        //! \param pSource - A pointer to a slice where the source code will be written, it is valid until the registry
+        //!                  is destroyed.
+        //!
+        //! \return True if the header was found.
+        bool TryGet(std::string_view name, ArraySlice<const Byte>* pSource);
+
+        //! \brief Get a hexadecimal SHA-256 hash of the names and sources of all the registered headers.
+        [[nodiscard]] std::string GetHash();
+
+        //! \brief Get the number of registered headers.
+        [[nodiscard]] USize GetIncludeCount();
+
+        inline static ResultCode Create(KernelIncludeRegistry** ppRegistry)
+        {
+            *ppRegistry = AllocateObject<KernelIncludeRegistry>();
+            (*ppRegistry)->AddRef();
+            return ResultCode::Success;
+        }
+    };
+} // namespace UN
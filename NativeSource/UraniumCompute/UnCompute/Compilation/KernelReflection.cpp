@@ -0,0 +1,592 @@
+#include <UnCompute/Compilation/KernelReflection.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace UN
+{
+    namespace
+    {
+        namespace SpirV
+        {
+            inline constexpr UInt32 MagicNumber = 0x07230203;
+            inline constexpr USize HeaderSize   = 5;
+
+            enum Op : UInt32
+            {
+                OpEntryPoint       = 15,
+                OpExecutionMode    = 16,
+                OpTypeInt          = 21,
+                OpTypeFloat        = 22,
+                OpTypeVector       = 23,
+                OpTypeMatrix       = 24,
+                OpTypeImage        = 25,
+                OpTypeSampler      = 26,
+                OpTypeSampledImage = 27,
+                OpTypeArray        = 28,
+                OpTypeRuntimeArray = 29,
+                OpTypeStruct       = 30,
+                OpTypePointer      = 32,
+                OpConstant         = 43,
+                OpVariable         = 59,
+                OpDecorate         = 71,
+                OpMemberDecorate   = 72,
+                OpExecutionModeId  = 331
+            };
+
+            enum Decoration : UInt32
+            {
+                DecorationBufferBlock   = 3,
+                DecorationArrayStride   = 6,
+                DecorationNonWritable   = 24,
+                DecorationBinding       = 33,
+                DecorationDescriptorSet = 34,
+                DecorationOffset        = 35
+            };
+
+            enum StorageClass : UInt32
+            {
+                StorageClassUniformConstant = 0,
+                StorageClassUniform         = 2,
+                StorageClassPushConstant    = 9,
+                StorageClassStorageBuffer   = 12
+            };
+
+            inline constexpr UInt32 ExecutionModelGLCompute  = 5;
+            inline constexpr UInt32 ExecutionModeLocalSize   = 17;
+            inline constexpr UInt32 ExecutionModeLocalSizeId = 38;
+            inline constexpr UInt32 DimBuffer                = 5;
+            inline constexpr UInt32 ImageSampledStorage      = 2;
+        } // namespace SpirV
+
+        struct SpirVType
+        {
+            UInt32 Opcode = 0;
+            std::vector<UInt32> Operands; //!< Instruction words after the result ID.
+        };
+
+        //! \brief Types, decorations and variables of a SPIR-V module needed for reflection.
+        struct SpirVModule
+        {
+            std::unordered_map<UInt32, SpirVType> Types;
+            std::unordered_map<UInt32, UInt32> Constants;
+            std::unordered_map<UInt32, UInt32> Bindings;
+            std::unordered_map<UInt32, UInt32> DescriptorSets;
+            std::unordered_map<UInt32, UInt32> ArrayStrides;
+            std::unordered_map<UInt32, std::unordered_map<UInt32, UInt32>> MemberOffsets;
+            std::unordered_map<UInt32, bool> BufferBlocks;
+            std::unordered_map<UInt32, bool> NonWritable;
+            std::vector<std::pair<UInt32, UInt32>> Variables; //!< Pairs of variable ID and pointer type ID.
+
+            [[nodiscard]] inline const SpirVType* FindType(UInt32 id) const
+            {
+                auto iter = Types.find(id);
+                return iter == Types.end() ? nullptr : &iter->second;
+            }
+
+            [[nodiscard]] inline UInt32 GetTypeSize(UInt32 id) const
+            {
+                auto* pType = FindType(id);
+                if (pType == nullptr)
+                {
+                    return 0;
+                }
+
+                auto& operands = pType->Operands;
+                switch (pType->Opcode)
+                {
+                case SpirV::OpTypeInt:
+                case SpirV::OpTypeFloat:
+                    return operands[0] / 8;
+                case SpirV::OpTypeVector:
+                case SpirV::OpTypeMatrix:
+                    return operands[1] * GetTypeSize(operands[0]);
+                case SpirV::OpTypeArray:
+                {
+                    auto lengthIter = Constants.find(operands[1]);
+                    auto strideIter = ArrayStrides.find(id);
+                    auto length     = lengthIter == Constants.end() ? 0 : lengthIter->second;
+                    auto stride     = strideIter == ArrayStrides.end() ? GetTypeSize(operands[0]) : strideIter->second;
+                    return length * stride;
+                }
+                case SpirV::OpTypeStruct:
+                {
+                    auto offsetsIter = MemberOffsets.find(id);
+                    UInt32 size      = 0;
+                    for (UInt32 i = 0; i < operands.size(); ++i)
+                    {
+                        UInt32 offset = size;
+                        if (offsetsIter != MemberOffsets.end())
+                        {
+                            if (auto iter = offsetsIter->second.find(i); iter != offsetsIter->second.end())
+                            {
+                                offset = iter->second;
+                            }
+                        }
+
+                        size = std::max(size, offset + GetTypeSize(operands[i]));
+                    }
+
+                    return size;
+                }
+                default:
+                    return 0;
+                }
+            }
+
+            //! \brief Get the stride of a structured buffer or the size of the struct if it has no runtime array.
+            [[nodiscard]] inline UInt32 GetBufferStride(UInt32 structId) const
+            {
+                auto& members = Types.at(structId).Operands;
+                if (!members.empty())
+                {
+                    auto* pLastMember = FindType(members.back());
+                    if (pLastMember && pLastMember->Opcode == SpirV::OpTypeRuntimeArray)
+                    {
+                        auto iter = ArrayStrides.find(members.back());
+                        return iter == ArrayStrides.end() ? GetTypeSize(pLastMember->Operands[0]) : iter->second;
+                    }
+                }
+
+                return GetTypeSize(structId);
+            }
+
+            [[nodiscard]] inline UInt32 GetMinMemberOffset(UInt32 structId) const
+            {
+                auto iter = MemberOffsets.find(structId);
+                if (iter == MemberOffsets.end() || iter->second.empty())
+                {
+                    return 0;
+                }
+
+                UInt32 result = UINT32_MAX;
+                for (auto& [member, offset] : iter->second)
+                {
+                    result = std::min(result, offset);
+                }
+
+                return result;
+            }
+
+            [[nodiscard]] inline bool IsReadOnly(UInt32 variableId, UInt32 structId) const
+            {
+                if (NonWritable.count(variableId))
+                {
+                    return true;
+                }
+
+                // DXC decorates the members of read-only structured and byte address buffers with NonWritable.
+                return NonWritable.count(structId) > 0;
+            }
+        };
+
+        inline Format ConvertImageFormat(UInt32 format)
+        {
+            switch (format)
+            {
+            case 1:
+                return Format::R32G32B32A32_SFloat;
+            case 2:
+                return Format::R16G16B16A16_SFloat;
+            case 3:
+                return Format::R32_SFloat;
+            case 4:
+                return Format::R8G8B8A8_UNorm;
+            case 5:
+                return Format::R8G8B8A8_SNorm;
+            case 6:
+                return Format::R32G32_SFloat;
+            case 7:
+                return Format::R16G16_SFloat;
+            case 9:
+                return Format::R16_SFloat;
+            case 10:
+                return Format::R16G16B16A16_UNorm;
+            case 12:
+                return Format::R16G16_UNorm;
+            case 13:
+                return Format::R8G8_UNorm;
+            case 14:
+                return Format::R16_UNorm;
+            case 15:
+                return Format::R8_UNorm;
+            case 16:
+                return Format::R16G16B16A16_SNorm;
+            case 17:
+                return Format::R16G16_SNorm;
+            case 18:
+                return Format::R8G8_SNorm;
+            case 19:
+                return Format::R16_SNorm;
+            case 20:
+                return Format::R8_SNorm;
+            case 21:
+                return Format::R32G32B32A32_SInt;
+            case 22:
+                return Format::R16G16B16A16_SInt;
+            case 23:
+                return Format::R8G8B8A8_SInt;
+            case 24:
+                return Format::R32_SInt;
+            case 25:
+                return Format::R32G32_SInt;
+            case 26:
+                return Format::R16G16_SInt;
+            case 27:
+                return Format::R8G8_SInt;
+            case 28:
+                return Format::R16_SInt;
+            case 29:
+                return Format::R8_SInt;
+            case 30:
+                return Format::R32G32B32A32_UInt;
+            case 31:
+                return Format::R16G16B16A16_UInt;
+            case 32:
+                return Format::R8G8B8A8_UInt;
+            case 33:
+                return Format::R32_UInt;
+            case 35:
+                return Format::R32G32_UInt;
+            case 36:
+                return Format::R16G16_UInt;
+            case 37:
+                return Format::R8G8_UInt;
+            case 38:
+                return Format::R16_UInt;
+            case 39:
+                return Format::R8_UInt;
+            default:
+                return Format::None;
+            }
+        }
+
+        //! \brief Get a single-channel format matching the sampled type of a typed buffer declared with unknown format.
+        inline Format GetDefaultTexelFormat(const SpirVModule& module, UInt32 sampledTypeId)
+        {
+            auto* pType = module.FindType(sampledTypeId);
+            if (pType == nullptr)
+            {
+                return Format::None;
+            }
+
+            if (pType->Opcode == SpirV::OpTypeFloat)
+            {
+                return Format::R32_SFloat;
+            }
+
+            if (pType->Opcode == SpirV::OpTypeInt)
+            {
+                return pType->Operands[1] ? Format::R32_SInt : Format::R32_UInt;
+            }
+
+            return Format::None;
+        }
+
+        inline bool ReadString(ArraySlice<const UInt32> words, std::string_view* pResult)
+        {
+            auto* pChars   = reinterpret_cast<const char*>(words.Data());
+            auto maxLength = words.Length() * sizeof(UInt32);
+            auto length    = strnlen(pChars, maxLength);
+            if (length == maxLength)
+            {
+                return false;
+            }
+
+            *pResult = std::string_view(pChars, length);
+            return true;
+        }
+    } // namespace
+
+    ResultCode KernelReflection::FromSpirV(ArraySlice<const Byte> bytecode, const char* entryPoint,
+                                           KernelReflection* pReflection)
+    {
+        if (bytecode.Length() % sizeof(UInt32) != 0 || bytecode.Length() < SpirV::HeaderSize * sizeof(UInt32))
+        {
+            UN_Error(false, "Invalid SPIR-V bytecode size: {}", bytecode.Length());
+            return ResultCode::InvalidArguments;
+        }
+
+        // The bytecode is not guaranteed to be aligned, copy it to access the words.
+        std::vector<UInt32> words(bytecode.Length() / sizeof(UInt32));
+        memcpy(words.data(), bytecode.Data(), bytecode.Length());
+        if (words[0] != SpirV::MagicNumber)
+        {
+            UN_Error(false, "Invalid SPIR-V magic number: {:#x}", words[0]);
+            return ResultCode::InvalidArguments;
+        }
+
+        SpirVModule module;
+        std::unordered_map<UInt32, WorkgroupSize> localSizes;
+        std::unordered_map<UInt32, std::array<UInt32, 3>> localSizeIds;
+        UInt32 entryPointId = 0;
+
+        for (USize offset = SpirV::HeaderSize; offset < words.size();)
+        {
+            auto wordCount = words[offset] >> 16;
+            auto opcode    = words[offset] & 0xffff;
+            if (wordCount == 0 || offset + wordCount > words.size())
+            {
+                UN_Error(false, "Invalid SPIR-V instruction at word {}", offset);
+                return ResultCode::InvalidArguments;
+            }
+
+            auto operands = ArraySlice<const UInt32>(words.data() + offset + 1, wordCount - 1);
+            offset += wordCount;
+
+            switch (opcode)
+            {
+            case SpirV::OpEntryPoint:
+                if (operands.Length() >= 3 && operands[0] == SpirV::ExecutionModelGLCompute)
+                {
+                    std::string_view name;
+                    if (!ReadString(operands(2, operands.Length()), &name))
+                    {
+                        UN_Error(false, "Invalid SPIR-V entry point name");
+                        return ResultCode::InvalidArguments;
+                    }
+
+                    if (entryPointId == 0 && (entryPoint == nullptr || name == entryPoint))
+                    {
+                        entryPointId = operands[1];
+                    }
+                }
+                break;
+            case SpirV::OpExecutionMode:
+                if (operands.Length() >= 5 && operands[1] == SpirV::ExecutionModeLocalSize)
+                {
+                    localSizes[operands[0]] = WorkgroupSize(operands[2], operands[3], operands[4]);
+                }
+                break;
+            case SpirV::OpExecutionModeId:
+                if (operands.Length() >= 5 && operands[1] == SpirV::ExecutionModeLocalSizeId)
+                {
+                    localSizeIds[operands[0]] = { operands[2], operands[3], operands[4] };
+                }
+                break;
+            case SpirV::OpTypeInt:
+            case SpirV::OpTypeFloat:
+            case SpirV::OpTypeVector:
+            case SpirV::OpTypeMatrix:
+            case SpirV::OpTypeImage:
+            case SpirV::OpTypeSampler:
+            case SpirV::OpTypeSampledImage:
+            case SpirV::OpTypeArray:
+            case SpirV::OpTypeRuntimeArray:
+            case SpirV::OpTypeStruct:
+            case SpirV::OpTypePointer:
+                if (operands.Any())
+                {
+                    auto& type    = module.Types[operands[0]];
+                    type.Opcode   = opcode;
+                    type.Operands = std::vector<UInt32>(operands.begin() + 1, operands.end());
+                }
+                break;
+            case SpirV::OpConstant:
+                if (operands.Length() >= 3)
+                {
+                    module.Constants[operands[1]] = operands[2];
+                }
+                break;
+            case SpirV::OpVariable:
+                if (operands.Length() >= 3)
+                {
+                    module.Variables.emplace_back(operands[1], operands[0]);
+                }
+                break;
+            case SpirV::OpDecorate:
+                if (operands.Length() < 2)
+                {
+                    break;
+                }
+
+                switch (operands[1])
+                {
+                case SpirV::DecorationBufferBlock:
+                    module.BufferBlocks[operands[0]] = true;
+                    break;
+                case SpirV::DecorationNonWritable:
+                    module.NonWritable[operands[0]] = true;
+                    break;
+                case SpirV::DecorationArrayStride:
+                    module.ArrayStrides[operands[0]] = operands.Length() > 2 ? operands[2] : 0;
+                    break;
+                case SpirV::DecorationBinding:
+                    module.Bindings[operands[0]] = operands.Length() > 2 ? operands[2] : 0;
+                    break;
+                case SpirV::DecorationDescriptorSet:
+                    module.DescriptorSets[operands[0]] = operands.Length() > 2 ? operands[2] : 0;
+                    break;
+                default:
+                    break;
+                }
+                break;
+            case SpirV::OpMemberDecorate:
+                if (operands.Length() >= 4 && operands[2] == SpirV::DecorationOffset)
+                {
+                    module.MemberOffsets[operands[0]][operands[1]] = operands[3];
+                }
+                else if (operands.Length() >= 3 && operands[2] == SpirV::DecorationNonWritable)
+                {
+                    module.NonWritable[operands[0]] = true;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+
+        if (entryPointId == 0)
+        {
+            UN_Error(false, "Compute entry point \"{}\" not found in SPIR-V module", entryPoint ? entryPoint : "");
+            return ResultCode::InvalidArguments;
+        }
+
+        KernelReflection reflection;
+        if (auto iter = localSizes.find(entryPointId); iter != localSizes.end())
+        {
+            reflection.LocalSize = iter->second;
+        }
+        else if (auto idIter = localSizeIds.find(entryPointId); idIter != localSizeIds.end())
+        {
+            auto getConstant = [&module](UInt32 id) {
+                auto iter = module.Constants.find(id);
+                return iter == module.Constants.end() ? UInt32{ 1 } : iter->second;
+            };
+
+            auto& ids            = idIter->second;
+            reflection.LocalSize = WorkgroupSize(getConstant(ids[0]), getConstant(ids[1]), getConstant(ids[2]));
+        }
+
+        std::vector<std::pair<KernelResourceDesc, UInt32>> resources;
+        std::vector<PushConstantRange> pushConstants;
+        for (auto& [variableId, pointerTypeId] : module.Variables)
+        {
+            auto* pPointer = module.FindType(pointerTypeId);
+            if (pPointer == nullptr || pPointer->Opcode != SpirV::OpTypePointer)
+            {
+                continue;
+            }
+
+            auto storageClass = pPointer->Operands[0];
+            auto typeId       = pPointer->Operands[1];
+            auto* pType       = module.FindType(typeId);
+            if (pType && (pType->Opcode == SpirV::OpTypeArray || pType->Opcode == SpirV::OpTypeRuntimeArray))
+            {
+                // Arrays of resources are bound to a single binding index.
+                typeId = pType->Operands[0];
+                pType  = module.FindType(typeId);
+            }
+
+            if (pType == nullptr)
+            {
+                continue;
+            }
+
+            if (storageClass == SpirV::StorageClassPushConstant && pType->Opcode == SpirV::OpTypeStruct)
+            {
+                auto rangeOffset = module.GetMinMemberOffset(typeId);
+                pushConstants.push_back(PushConstantRange{ rangeOffset, module.GetTypeSize(typeId) - rangeOffset });
+                continue;
+            }
+
+            auto bindingIter = module.Bindings.find(variableId);
+            if (bindingIter == module.Bindings.end())
+            {
+                continue;
+            }
+
+            if (auto iter = module.DescriptorSets.find(variableId); iter != module.DescriptorSets.end() && iter->second != 0)
+            {
+                UN_Error(false, "Resource at binding {} uses descriptor set {}, only set 0 is supported",
+                         bindingIter->second, iter->second);
+                return ResultCode::InvalidArguments;
+            }
+
+            KernelResourceDesc resource;
+            resource.BindingIndex = static_cast<Int32>(bindingIter->second);
+            UInt32 size           = 0;
+
+            if (pType->Opcode == SpirV::OpTypeStruct)
+            {
+                bool isStorageBuffer = storageClass == SpirV::StorageClassStorageBuffer
+                    || (storageClass == SpirV::StorageClassUniform && module.BufferBlocks.count(typeId));
+                if (isStorageBuffer)
+                {
+                    resource.Kind = module.IsReadOnly(variableId, typeId) ? KernelResourceKind::Buffer
+                                                                           : KernelResourceKind::RWBuffer;
+                    size          = module.GetBufferStride(typeId);
+                }
+                else if (storageClass == SpirV::StorageClassUniform)
+                {
+                    resource.Kind = KernelResourceKind::ConstantBuffer;
+                    size          = module.GetTypeSize(typeId);
+                }
+                else
+                {
+                    continue;
+                }
+            }
+            else if (pType->Opcode == SpirV::OpTypeImage && pType->Operands.size() >= 7)
+            {
+                auto& image    = pType->Operands;
+                bool isStorage = image[5] == SpirV::ImageSampledStorage;
+                if (image[1] == SpirV::DimBuffer)
+                {
+                    resource.Kind   = isStorage ? KernelResourceKind::RWBuffer : KernelResourceKind::Buffer;
+                    resource.Format = ConvertImageFormat(image[6]);
+                    if (resource.Format == Format::None)
+                    {
+                        resource.Format = GetDefaultTexelFormat(module, image[0]);
+                    }
+                }
+                else
+                {
+                    resource.Kind = isStorage ? KernelResourceKind::RWTexture : KernelResourceKind::SampledTexture;
+                }
+            }
+            else if (pType->Opcode == SpirV::OpTypeSampledImage)
+            {
+                resource.Kind = KernelResourceKind::SampledTexture;
+            }
+            else if (pType->Opcode == SpirV::OpTypeSampler)
+            {
+                resource.Kind = KernelResourceKind::Sampler;
+            }
+            else
+            {
+                continue;
+            }
+
+            resources.emplace_back(resource, size);
+        }
+
+        std::stable_sort(resources.begin(), resources.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.first.BindingIndex < rhs.first.BindingIndex;
+        });
+
+        // Aliased resources share a binding index, only the first one is kept.
+        resources.erase(std::unique(resources.begin(),
+                                    resources.end(),
+                                    [](const auto& lhs, const auto& rhs) {
+                                        return lhs.first.BindingIndex == rhs.first.BindingIndex;
+                                    }),
+                        resources.end());
+
+        reflection.ResourceLayout = HeapArray<KernelResourceDesc>(resources.size());
+        reflection.ResourceSizes  = HeapArray<UInt32>(resources.size());
+        for (USize i = 0; i < resources.size(); ++i)
+        {
+            reflection.ResourceLayout[i] = resources[i].first;
+            reflection.ResourceSizes[i]  = resources[i].second;
+        }
+
+        reflection.PushConstantRanges = HeapArray<PushConstantRange>::CopyFrom(pushConstants);
+
+        *pReflection = std::move(reflection);
+        return ResultCode::Success;
+    }
+} // namespace UN
@@ -0,0 +1,41 @@
+#pragma once
+#include <UnCompute/Backend/IKernel.h>
+#include <UnCompute/Backend/IResourceBinding.h>
+#include <UnCompute/Containers/HeapArray.h>
+
+namespace UN
+{
+    //! \brief A range of push constants used by a kernel.
+    struct PushConstantRange
+    {
+        UInt32 Offset = 0; //!< Offset of the first push constant in bytes.
+        UInt32 Size   = 0; //!< Size of the range in bytes.
+    };
+
+    //! \brief Reflection data of a compiled kernel.
+    struct KernelReflection
+    {
+        WorkgroupSize LocalSize; //!< Workgroup size declared in the kernel.
+
+        //! \brief Resources used by the kernel sorted by binding index, can be used as ResourceBindingDesc::Layout.
+        //!
+        //! The format of typed buffers is derived from the element type declared in the kernel, e.g. R32_SFloat for
+        //! `Buffer<float>`. It must be changed if the buffer stores the data in another format.
+        HeapArray<KernelResourceDesc> ResourceLayout;
+
+        //! \brief Size of a constant buffer or stride of a structured buffer in bytes for every resource in
+        //!        ResourceLayout, zero for other resources.
+        HeapArray<UInt32> ResourceSizes;
+
+        HeapArray<PushConstantRange> PushConstantRanges; //!< Push constant ranges used by the kernel.
+
+        //! \brief Get reflection data from SPIR-V bytecode.
+        //!
+        //! \param bytecode    - SPIR-V module that contains the kernel.
+        //! \param entryPoint  - Name of the kernel entry point, null to use the first compute entry point.
+        //! \param pReflection - A pointer to a structure where the reflection data will be written.
+        //!
+        //! \return ResultCode::Success or an error code.
+        static ResultCode FromSpirV(ArraySlice<const Byte> bytecode, const char* entryPoint, KernelReflection* pReflection);
+    };
+} // namespace UN
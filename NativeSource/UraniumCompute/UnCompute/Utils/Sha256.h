@@ -0,0 +1,175 @@
+#pragma once
+#include <UnCompute/Base/Byte.h>
+#include <UnCompute/Containers/ArraySlice.h>
+#include <array>
+#include <string>
+#include <string_view>
+
+namespace UN
+{
+    //! \brief Incremental SHA-256 hash calculator.
+    class Sha256 final
+    {
+    public:
+        //! \brief Size of the hash in bytes.
+        inline static constexpr USize DigestSize = 32;
+
+        using Digest = std::array<UInt8, DigestSize>;
+
+    private:
+        inline static constexpr USize BlockSize = 64;
+
+        inline static constexpr UInt32 RoundConstants[64] = {
+            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+            0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+            0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+            0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+            0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+            0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+            0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+        };
+
+        std::array<UInt32, 8> m_State = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                          0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+        std::array<UInt8, BlockSize> m_Block{};
+        USize m_BlockSize  = 0;
+        UInt64 m_TotalSize = 0;
+
+        inline static UInt32 RotateRight(UInt32 x, UInt32 n)
+        {
+            return (x >> n) | (x << (32 - n));
+        }
+
+        inline void ProcessBlock()
+        {
+            UInt32 w[64];
+            for (USize i = 0; i < 16; ++i)
+            {
+                w[i] = static_cast<UInt32>(m_Block[i * 4]) << 24 | static_cast<UInt32>(m_Block[i * 4 + 1]) << 16
+                    | static_cast<UInt32>(m_Block[i * 4 + 2]) << 8 | static_cast<UInt32>(m_Block[i * 4 + 3]);
+            }
+
+            for (USize i = 16; i < 64; ++i)
+            {
+                auto s0 = RotateRight(w[i - 15], 7) ^ RotateRight(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                auto s1 = RotateRight(w[i - 2], 17) ^ RotateRight(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                w[i]    = w[i - 16] + s0 + w[i - 7] + s1;
+            }
+
+            auto [a, b, c, d, e, f, g, h] = m_State;
+            for (USize i = 0; i < 64; ++i)
+            {
+                auto s1    = RotateRight(e, 6) ^ RotateRight(e, 11) ^ RotateRight(e, 25);
+                auto ch    = (e & f) ^ (~e & g);
+                auto temp1 = h + s1 + ch + RoundConstants[i] + w[i];
+                auto s0    = RotateRight(a, 2) ^ RotateRight(a, 13) ^ RotateRight(a, 22);
+                auto maj   = (a & b) ^ (a & c) ^ (b & c);
+                auto temp2 = s0 + maj;
+
+                h = g;
+                g = f;
+                f = e;
+                e = d + temp1;
+                d = c;
+                c = b;
+                b = a;
+                a = temp1 + temp2;
+            }
+
+            m_State[0] += a;
+            m_State[1] += b;
+            m_State[2] += c;
+            m_State[3] += d;
+            m_State[4] += e;
+            m_State[5] += f;
+            m_State[6] += g;
+            m_State[7] += h;
+        }
+
+    public:
+        //! \brief Add data to the hash.
+        inline void Update(const void* pData, USize size)
+        {
+            auto* pBytes = static_cast<const UInt8*>(pData);
+            m_TotalSize += size;
+            for (USize i = 0; i < size; ++i)
+            {
+                m_Block[m_BlockSize++] = pBytes[i];
+                if (m_BlockSize == BlockSize)
+                {
+                    ProcessBlock();
+                    m_BlockSize = 0;
+                }
+            }
+        }
+
+        //! \brief Add data to the hash.
+        inline void Update(ArraySlice<const Byte> data)
+        {
+            Update(data.Data(), data.Length());
+        }
+
+        //! \brief Add a string to the hash, the string is prefixed with its length, so that "ab", "c" and "a", "bc"
+        //!        sequences produce different hashes.
+        inline void Update(std::string_view str)
+        {
+            UpdateValue(static_cast<UInt64>(str.size()));
+            Update(str.data(), str.size());
+        }
+
+        //! \brief Add a trivially copyable value to the hash.
+        template<class T>
+        inline void UpdateValue(const T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            Update(&value, sizeof(T));
+        }
+
+        //! \brief Finish the calculation and get the hash, the object must not be used after this call.
+        inline Digest Finalize()
+        {
+            auto totalBits = m_TotalSize * 8;
+
+            UInt8 padding = 0x80;
+            Update(&padding, 1);
+            padding = 0;
+            while (m_BlockSize != BlockSize - sizeof(UInt64))
+            {
+                Update(&padding, 1);
+            }
+
+            for (Int32 i = 7; i >= 0; --i)
+            {
+                auto lengthByte = static_cast<UInt8>(totalBits >> (i * 8));
+                Update(&lengthByte, 1);
+            }
+
+            Digest result;
+            for (USize i = 0; i < 8; ++i)
+            {
+                result[i * 4]     = static_cast<UInt8>(m_State[i] >> 24);
+                result[i * 4 + 1] = static_cast<UInt8>(m_State[i] >> 16);
+                result[i * 4 + 2] = static_cast<UInt8>(m_State[i] >> 8);
+                result[i * 4 + 3] = static_cast<UInt8>(m_State[i]);
+            }
+
+            return result;
+        }
+
+        //! \brief Convert a hash to a lowercase hexadecimal string.
+        inline static std::string ToHex(const Digest& digest)
+        {
+            constexpr const char* digits = "0123456789abcdef";
+
+            std::string result(DigestSize * 2, '0');
+            for (USize i = 0; i < DigestSize; ++i)
+            {
+                result[i * 2]     = digits[digest[i] >> 4];
+                result[i * 2 + 1] = digits[digest[i] & 0xf];
+            }
+
+            return result;
+        }
+    };
+} // namespace UN
@@ -20,8 +20,9 @@ namespace UN
         m_Memory      = deviceMemory;
         m_MemoryOwner = un_verify_cast<VulkanDeviceMemory*>(m_Memory.GetDeviceMemory());
         auto vkMemory = m_MemoryOwner->GetNativeMemory();
-        if (auto vkResult = vkBindBufferMemory(
-                m_pDevice.As<VulkanComputeDevice>()->GetNativeDevice(), m_NativeBuffer, vkMemory, deviceMemory.GetByteOffset());
+        auto* pDevice = m_pDevice.As<VulkanComputeDevice>();
+        if (auto vkResult = pDevice->GetDeviceTable().vkBindBufferMemory(
+                pDevice->GetNativeDevice(), m_NativeBuffer, vkMemory, deviceMemory.GetByteOffset());
             Failed(vkResult))
         {
             UN_Error(false, "Couldn't bind Vulkan memory to buffer, vkBindBufferMemory returned {}", vkResult);
@@ -31,11 +32,68 @@ namespace UN
         return ResultCode::Success;
     }
 
+    ResultCode VulkanBuffer::GetBufferView(Format format, VkBufferView* pView)
+    {
+        for (auto& [viewFormat, view] : m_BufferViews)
+        {
+            if (viewFormat == format)
+            {
+                *pView = view;
+                return ResultCode::Success;
+            }
+        }
+
+        auto formatSize = GetFormatSize(format);
+        if (formatSize == 0)
+        {
+            UN_Error(false, "Typed views of buffer \"{}\" require a texel format", m_Name);
+            return ResultCode::InvalidArguments;
+        }
+
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto elementCount = m_Desc.Size / formatSize;
+        auto maxElements  = pDevice->GetLimits().maxTexelBufferElements;
+        if (elementCount > maxElements)
+        {
+            UN_Error(false, "Buffer \"{}\" has {} texels, but typed views are limited to {} texels by the device", m_Name,
+                     elementCount, maxElements);
+            return ResultCode::InvalidArguments;
+        }
+
+        VkBufferViewCreateInfo viewCI{};
+        viewCI.sType  = VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO;
+        viewCI.buffer = m_NativeBuffer;
+        viewCI.format = VulkanConvert(format);
+        viewCI.offset = 0;
+        viewCI.range  = VK_WHOLE_SIZE;
+
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+        if (auto vkResult = deviceTable.vkCreateBufferView(vkDevice, &viewCI, nullptr, pView); Failed(vkResult))
+        {
+            UN_Error(false, "Couldn't create Vulkan buffer view, vkCreateBufferView returned {}", vkResult);
+            return VulkanConvert(vkResult);
+        }
+
+        m_BufferViews.emplace_back(format, *pView);
+        return ResultCode::Success;
+    }
+
     void VulkanBuffer::Reset()
     {
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+        for (auto& [format, view] : m_BufferViews)
+        {
+            deviceTable.vkDestroyBufferView(vkDevice, view, nullptr);
+        }
+
+        m_BufferViews.clear();
+
         if (m_NativeBuffer != VK_NULL_HANDLE)
         {
-            vkDestroyBuffer(m_pDevice.As<VulkanComputeDevice>()->GetNativeDevice(), m_NativeBuffer, nullptr);
+            deviceTable.vkDestroyBuffer(vkDevice, m_NativeBuffer, nullptr);
             m_NativeBuffer = VK_NULL_HANDLE;
         }
     }
@@ -49,25 +107,34 @@ namespace UN
 
         if (desc.Usage == BufferUsage::Storage)
         {
-            bufferCI.usage |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT;
+            bufferCI.usage |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT
+                | VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT;
         }
         else if (desc.Usage == BufferUsage::Constant)
         {
             bufferCI.usage |= VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
         }
+        else if (desc.Usage == BufferUsage::Indirect)
+        {
+            bufferCI.usage |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT
+                | VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+        }
         else
         {
             UN_Error(false, "Unknown buffer usage type <{}>", static_cast<Int32>(desc.Usage));
         }
 
-        auto vkDevice = m_pDevice.As<VulkanComputeDevice>()->GetNativeDevice();
-        if (auto vkResult = vkCreateBuffer(vkDevice, &bufferCI, VK_NULL_HANDLE, &m_NativeBuffer); Failed(vkResult))
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+        if (auto vkResult = deviceTable.vkCreateBuffer(vkDevice, &bufferCI, VK_NULL_HANDLE, &m_NativeBuffer); Failed(vkResult))
         {
             UN_Error(false, "Couldn't create Vulkan buffer, vkCreateBuffer returned {}", vkResult);
             return VulkanConvert(vkResult);
         }
 
-        vkGetBufferMemoryRequirements(vkDevice, m_NativeBuffer, &m_MemoryRequirements);
+        deviceTable.vkGetBufferMemoryRequirements(vkDevice, m_NativeBuffer, &m_MemoryRequirements);
+        pDevice->SetDebugName(VK_OBJECT_TYPE_BUFFER, reinterpret_cast<UInt64>(m_NativeBuffer), m_Name);
         return ResultCode::Success;
     }
 
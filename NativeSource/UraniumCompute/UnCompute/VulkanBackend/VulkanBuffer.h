@@ -15,6 +15,8 @@ namespace UN
         Ptr<VulkanDeviceMemory> m_MemoryOwner     = {}; // !!! must be here to not free the memory before ~DeviceMemorySlice()
         DeviceMemorySlice m_Memory                = {};
 
+        std::vector<std::pair<Format, VkBufferView>> m_BufferViews;
+
     protected:
         ResultCode InitInternal(const BufferDesc& desc) override;
 
@@ -31,6 +33,16 @@ namespace UN
             return m_NativeBuffer;
         }
 
+        //! \brief Get a typed view of the whole buffer, the view is created on first use and cached for each format.
+        //!
+        //! Fails if the buffer holds more texels of the format than VkPhysicalDeviceLimits::maxTexelBufferElements.
+        //!
+        //! \param format - Texel format of the view.
+        //! \param pView  - A pointer to the variable that receives the view.
+        //!
+        //! \return ResultCode::Success or an error code.
+        ResultCode GetBufferView(Format format, VkBufferView* pView);
+
         [[nodiscard]] inline const VkMemoryRequirements& GetMemoryRequirements() const
         {
             return m_MemoryRequirements;
@@ -4,6 +4,7 @@
 #include <UnCompute/VulkanBackend/VulkanComputeDevice.h>
 #include <UnCompute/VulkanBackend/VulkanDeviceMemory.h>
 #include <UnCompute/VulkanBackend/VulkanFence.h>
+#include <UnCompute/VulkanBackend/VulkanImage.h>
 #include <UnCompute/VulkanBackend/VulkanKernel.h>
 #include <UnCompute/VulkanBackend/VulkanResourceBinding.h>
 
@@ -13,12 +14,13 @@ namespace UN
     {
         VkAccessFlags result = VK_FLAGS_NONE;
         // clang-format off
-        if (AllFlagsActive(flags, AccessFlags::KernelRead))    { result |= VK_ACCESS_SHADER_READ_BIT;    }
-        if (AllFlagsActive(flags, AccessFlags::KernelWrite))   { result |= VK_ACCESS_SHADER_WRITE_BIT;   }
-        if (AllFlagsActive(flags, AccessFlags::TransferRead))  { result |= VK_ACCESS_TRANSFER_READ_BIT;  }
-        if (AllFlagsActive(flags, AccessFlags::TransferWrite)) { result |= VK_ACCESS_TRANSFER_WRITE_BIT; }
-        if (AllFlagsActive(flags, AccessFlags::HostRead))      { result |= VK_ACCESS_HOST_READ_BIT;      }
-        if (AllFlagsActive(flags, AccessFlags::HostWrite))     { result |= VK_ACCESS_HOST_WRITE_BIT;     }
+        if (AllFlagsActive(flags, AccessFlags::KernelRead))    { result |= VK_ACCESS_SHADER_READ_BIT;           }
+        if (AllFlagsActive(flags, AccessFlags::KernelWrite))   { result |= VK_ACCESS_SHADER_WRITE_BIT;          }
+        if (AllFlagsActive(flags, AccessFlags::TransferRead))  { result |= VK_ACCESS_TRANSFER_READ_BIT;         }
+        if (AllFlagsActive(flags, AccessFlags::TransferWrite)) { result |= VK_ACCESS_TRANSFER_WRITE_BIT;        }
+        if (AllFlagsActive(flags, AccessFlags::HostRead))      { result |= VK_ACCESS_HOST_READ_BIT;             }
+        if (AllFlagsActive(flags, AccessFlags::HostWrite))     { result |= VK_ACCESS_HOST_WRITE_BIT;            }
+        if (AllFlagsActive(flags, AccessFlags::IndirectRead))  { result |= VK_ACCESS_INDIRECT_COMMAND_READ_BIT; }
         // clang-format on
         return result;
     }
@@ -50,7 +52,13 @@ namespace UN
         }
 
         auto device = m_pDevice.As<VulkanComputeDevice>();
-        vkFreeCommandBuffers(device->GetNativeDevice(), m_CommandPool, 1, &m_CommandBuffer);
+        if (m_TimestampQueryPool)
+        {
+            m_pDeviceTable->vkDestroyQueryPool(device->GetNativeDevice(), m_TimestampQueryPool, nullptr);
+            m_TimestampQueryPool = VK_NULL_HANDLE;
+        }
+
+        m_pDeviceTable->vkFreeCommandBuffers(device->GetNativeDevice(), m_CommandPool, 1, &m_CommandBuffer);
         m_CommandBuffer = VK_NULL_HANDLE;
         m_CommandPool   = VK_NULL_HANDLE;
         m_Queue         = VK_NULL_HANDLE;
@@ -69,10 +77,11 @@ namespace UN
             return result;
         }
 
-        auto device           = m_pDevice.As<VulkanComputeDevice>();
-        auto queueFamilyIndex = device->GetQueueFamilyIndex(desc.QueueKindFlags);
-        m_CommandPool         = device->GetCommandPool(queueFamilyIndex);
-        m_Queue               = device->GetDeviceQueue(queueFamilyIndex, 0);
+        auto device        = m_pDevice.As<VulkanComputeDevice>();
+        m_QueueFamilyIndex = device->GetQueueFamilyIndex(desc.QueueKindFlags);
+        m_CommandPool      = device->GetCommandPool(m_QueueFamilyIndex);
+        m_Queue            = device->GetDeviceQueue(m_QueueFamilyIndex, 0);
+        m_pDeviceTable     = &device->GetDeviceTable();
 
         VkCommandBufferAllocateInfo allocateInfo{};
         allocateInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
@@ -80,8 +89,37 @@ namespace UN
         allocateInfo.commandBufferCount = 1;
         allocateInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
 
-        auto vkResult = vkAllocateCommandBuffers(device->GetNativeDevice(), &allocateInfo, &m_CommandBuffer);
+        auto vkResult = m_pDeviceTable->vkAllocateCommandBuffers(device->GetNativeDevice(), &allocateInfo, &m_CommandBuffer);
         UN_VerifyResult(vkResult, "Couldn't allocate Vulkan command buffer");
+        if (Failed(vkResult))
+        {
+            return VulkanConvert(vkResult);
+        }
+
+        device->SetDebugName(VK_OBJECT_TYPE_COMMAND_BUFFER, reinterpret_cast<UInt64>(m_CommandBuffer), m_Name);
+        if (desc.TimestampQueryCount == 0)
+        {
+            return ResultCode::Success;
+        }
+
+        if (!device->GetLimits().timestampComputeAndGraphics)
+        {
+            UN_Error(false, "Timestamp queries are not supported by the adapter");
+            return ResultCode::InvalidOperation;
+        }
+
+        VkQueryPoolCreateInfo queryPoolCI{};
+        queryPoolCI.sType      = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        queryPoolCI.queryType  = VK_QUERY_TYPE_TIMESTAMP;
+        queryPoolCI.queryCount = desc.TimestampQueryCount;
+
+        vkResult = m_pDeviceTable->vkCreateQueryPool(device->GetNativeDevice(), &queryPoolCI, nullptr, &m_TimestampQueryPool);
+        UN_VerifyResult(vkResult, "Couldn't create Vulkan timestamp query pool");
+        if (Succeeded(vkResult))
+        {
+            device->SetDebugName(VK_OBJECT_TYPE_QUERY_POOL, reinterpret_cast<UInt64>(m_TimestampQueryPool), m_Name);
+        }
+
         return VulkanConvert(vkResult);
     }
 
@@ -94,17 +132,18 @@ namespace UN
             beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
         }
 
-        return VulkanConvert(vkBeginCommandBuffer(m_CommandBuffer, &beginInfo));
+        return VulkanConvert(m_pDeviceTable->vkBeginCommandBuffer(m_CommandBuffer, &beginInfo));
     }
 
     ResultCode VulkanCommandList::EndInternal()
     {
-        return VulkanConvert(vkEndCommandBuffer(m_CommandBuffer));
+        TranslateCommands();
+        return VulkanConvert(m_pDeviceTable->vkEndCommandBuffer(m_CommandBuffer));
     }
 
     ResultCode VulkanCommandList::ResetStateInternal()
     {
-        return VulkanConvert(vkResetCommandBuffer(m_CommandBuffer, VK_FLAGS_NONE));
+        return VulkanConvert(m_pDeviceTable->vkResetCommandBuffer(m_CommandBuffer, VK_FLAGS_NONE));
     }
 
     ResultCode VulkanCommandList::SubmitInternal()
@@ -116,38 +155,51 @@ namespace UN
 
         m_pFence->ResetState();
         VkFence vkFence = m_pFence.As<VulkanFence>()->GetNativeFence();
-        return VulkanConvert(vkQueueSubmit(m_Queue, 1, &info, vkFence));
+        return VulkanConvert(m_pDeviceTable->vkQueueSubmit(m_Queue, 1, &info, vkFence));
     }
 
-    void VulkanCommandList::CmdCopy(IBuffer* pSource, IBuffer* pDestination, const BufferCopyRegion& region)
+    ResultCode VulkanCommandList::WatchCompletionInternal(CommandListCompletionCallback callback, void* pUserData)
     {
-        auto nativeSrc = un_verify_cast<VulkanBuffer*>(pSource)->GetNativeBuffer();
-        auto nativeDst = un_verify_cast<VulkanBuffer*>(pDestination)->GetNativeBuffer();
-
-        VkBufferCopy copy{};
-        copy.size      = region.Size;
-        copy.dstOffset = region.DestOffset;
-        copy.srcOffset = region.SourceOffset;
-        vkCmdCopyBuffer(m_CommandBuffer, nativeSrc, nativeDst, 1, &copy);
+        VkFence vkFence = m_pFence.As<VulkanFence>()->GetNativeFence();
+        auto device = m_pDevice.As<VulkanComputeDevice>();
+        device->GetCompletionThread(m_QueueFamilyIndex).Add(vkFence, this, callback, pUserData);
+        return ResultCode::Success;
     }
 
-    void VulkanCommandList::CmdDispatch(IKernel* pKernel, Int32 x, Int32 y, Int32 z)
+    ResultCode VulkanCommandList::GetTimestampsInternal(ArraySlice<UInt64> timestamps)
     {
-        auto* pVkKernel        = un_verify_cast<VulkanKernel*>(pKernel);
-        auto* pResourceBinding = pVkKernel->GetResourceBinding();
-        auto descriptorSet     = pResourceBinding->GetNativeDescriptorSet();
+        if (timestamps.Empty())
+        {
+            return ResultCode::Success;
+        }
+
+        auto device   = m_pDevice.As<VulkanComputeDevice>();
+        auto count    = static_cast<UInt32>(timestamps.Length());
+        auto vkResult = m_pDeviceTable->vkGetQueryPoolResults(device->GetNativeDevice(),
+                                                              m_TimestampQueryPool,
+                                                              0,
+                                                              count,
+                                                              count * sizeof(UInt64),
+                                                              timestamps.Data(),
+                                                              sizeof(UInt64),
+                                                              VK_QUERY_RESULT_64_BIT);
+        if (vkResult == VK_NOT_READY)
+        {
+            UN_Error(false, "Some of the timestamps were not written by the last execution of the command list");
+            return ResultCode::InvalidOperation;
+        }
+        if (Failed(vkResult))
+        {
+            return VulkanConvert(vkResult);
+        }
 
-        vkCmdBindPipeline(m_CommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pVkKernel->GetNativePipeline());
-        vkCmdBindDescriptorSets(m_CommandBuffer,
-                                VK_PIPELINE_BIND_POINT_COMPUTE,
-                                pResourceBinding->GetNativePipelineLayout(),
-                                0,
-                                1,
-                                &descriptorSet,
-                                0,
-                                nullptr);
+        auto period = static_cast<Float64>(device->GetLimits().timestampPeriod);
+        for (auto& timestamp : timestamps)
+        {
+            timestamp = static_cast<UInt64>(static_cast<Float64>(timestamp) * period);
+        }
 
-        vkCmdDispatch(m_CommandBuffer, x, y, z);
+        return ResultCode::Success;
     }
 
     VulkanCommandList::~VulkanCommandList()
@@ -155,33 +207,236 @@ namespace UN
         Reset();
     }
 
-    void VulkanCommandList::CmdMemoryBarrier(IBuffer* pBuffer, const MemoryBarrierDesc& barrierDesc)
-    {
-        VkBufferMemoryBarrier barrier{};
-        barrier.sType         = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
-        barrier.offset        = 0;
-        barrier.size          = VK_WHOLE_SIZE;
-        barrier.buffer        = un_verify_cast<VulkanBuffer*>(pBuffer)->GetNativeBuffer();
-        barrier.srcAccessMask = VulkanConvert(barrierDesc.SourceAccess);
-        barrier.dstAccessMask = VulkanConvert(barrierDesc.DestAccess);
-
-        auto* pDevice               = m_pDevice.As<VulkanComputeDevice>();
-        barrier.srcQueueFamilyIndex = barrierDesc.SourceQueueKind == HardwareQueueKindFlags::None
-            ? VK_QUEUE_FAMILY_IGNORED
-            : pDevice->GetQueueFamilyIndex(barrierDesc.SourceQueueKind);
-        barrier.dstQueueFamilyIndex = barrierDesc.DestQueueKind == HardwareQueueKindFlags::None
-            ? VK_QUEUE_FAMILY_IGNORED
-            : pDevice->GetQueueFamilyIndex(barrierDesc.DestQueueKind);
-
-        vkCmdPipelineBarrier(m_CommandBuffer,
-                             VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                             VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                             VK_FLAGS_NONE,
-                             0,
-                             nullptr,
-                             1,
-                             &barrier,
-                             0,
-                             nullptr);
+    VkBufferImageCopy VulkanCommandList::GetBufferImageCopy(const BufferImageCopyRegion& region)
+    {
+        VkBufferImageCopy copy{};
+        copy.bufferOffset                    = region.BufferOffset;
+        copy.bufferRowLength                 = 0;
+        copy.bufferImageHeight               = 0;
+        copy.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        copy.imageSubresource.mipLevel       = 0;
+        copy.imageSubresource.baseArrayLayer = 0;
+        copy.imageSubresource.layerCount     = 1;
+        copy.imageOffset.x                   = static_cast<Int32>(region.ImageX);
+        copy.imageOffset.y                   = static_cast<Int32>(region.ImageY);
+        copy.imageOffset.z                   = static_cast<Int32>(region.ImageZ);
+        copy.imageExtent.width               = region.Width;
+        copy.imageExtent.height              = region.Height;
+        copy.imageExtent.depth               = region.Depth;
+        return copy;
+    }
+
+    void VulkanCommandList::BindKernel(VulkanKernel* pKernel)
+    {
+        auto* pResourceBinding = pKernel->GetResourceBinding();
+        auto pipeline          = pKernel->GetNativePipeline();
+        auto pipelineLayout    = pResourceBinding->GetNativePipelineLayout();
+        auto descriptorSet     = pResourceBinding->GetNativeDescriptorSet();
+
+        if (pipeline != m_BoundPipeline)
+        {
+            m_pDeviceTable->vkCmdBindPipeline(m_CommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+            m_BoundPipeline = pipeline;
+        }
+
+        // Descriptor sets stay bound when the pipeline changes as long as the layout is the same.
+        if (descriptorSet != m_BoundDescriptorSet || pipelineLayout != m_BoundPipelineLayout)
+        {
+            m_pDeviceTable->vkCmdBindDescriptorSets(m_CommandBuffer,
+                                                    VK_PIPELINE_BIND_POINT_COMPUTE,
+                                                    pipelineLayout,
+                                                    0,
+                                                    1,
+                                                    &descriptorSet,
+                                                    0,
+                                                    nullptr);
+            m_BoundPipelineLayout = pipelineLayout;
+            m_BoundDescriptorSet  = descriptorSet;
+        }
+    }
+
+    UInt32 VulkanCommandList::GetBarrierQueueFamilyIndex(HardwareQueueKindFlags queueKind)
+    {
+        return queueKind == HardwareQueueKindFlags::None ? VK_QUEUE_FAMILY_IGNORED
+                                                         : m_pDevice.As<VulkanComputeDevice>()->GetQueueFamilyIndex(queueKind);
+    }
+
+    void VulkanCommandList::TranslateCommands()
+    {
+        // A command buffer doesn't inherit any state, the binds are tracked from scratch on every recording.
+        m_BoundPipeline       = VK_NULL_HANDLE;
+        m_BoundPipelineLayout = VK_NULL_HANDLE;
+        m_BoundDescriptorSet  = VK_NULL_HANDLE;
+
+        if (m_TimestampQueryPool)
+        {
+            m_pDeviceTable->vkCmdResetQueryPool(m_CommandBuffer, m_TimestampQueryPool, 0, m_Desc.TimestampQueryCount);
+        }
+
+        for (auto& command : m_CommandStream)
+        {
+            switch (command.Type)
+            {
+            case CommandType::MemoryBarrier:
+                Translate(command.Get<MemoryBarrierCommand>());
+                break;
+            case CommandType::CopyBuffer:
+                Translate(command.Get<CopyBufferCommand>());
+                break;
+            case CommandType::CopyBufferToImage:
+                Translate(command.Get<CopyBufferToImageCommand>());
+                break;
+            case CommandType::CopyImageToBuffer:
+                Translate(command.Get<CopyImageToBufferCommand>());
+                break;
+            case CommandType::Fill:
+                Translate(command.Get<FillCommand>());
+                break;
+            case CommandType::Update:
+                Translate(command.Get<UpdateCommand>());
+                break;
+            case CommandType::Dispatch:
+                Translate(command.Get<DispatchCommand>());
+                break;
+            case CommandType::DispatchIndirect:
+                Translate(command.Get<DispatchIndirectCommand>());
+                break;
+            case CommandType::WriteTimestamp:
+                Translate(command.Get<WriteTimestampCommand>());
+                break;
+            default:
+                UN_Assert(false, "Unknown command type {}", static_cast<UInt32>(command.Type));
+                break;
+            }
+        }
+    }
+
+    void VulkanCommandList::Translate(const MemoryBarrierCommand& command)
+    {
+        m_BufferBarriers.clear();
+        m_ImageBarriers.clear();
+        for (auto& resourceBarrier : command.GetBarriers())
+        {
+            auto& desc = resourceBarrier.Desc;
+            if (resourceBarrier.pBuffer)
+            {
+                auto& barrier               = m_BufferBarriers.emplace_back();
+                barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+                barrier.offset              = 0;
+                barrier.size                = VK_WHOLE_SIZE;
+                barrier.buffer              = un_verify_cast<VulkanBuffer*>(resourceBarrier.pBuffer)->GetNativeBuffer();
+                barrier.srcAccessMask       = VulkanConvert(desc.SourceAccess);
+                barrier.dstAccessMask       = VulkanConvert(desc.DestAccess);
+                barrier.srcQueueFamilyIndex = GetBarrierQueueFamilyIndex(desc.SourceQueueKind);
+                barrier.dstQueueFamilyIndex = GetBarrierQueueFamilyIndex(desc.DestQueueKind);
+                continue;
+            }
+
+            auto* pVkImage = un_verify_cast<VulkanImage*>(resourceBarrier.pImage);
+
+            auto& barrier                           = m_ImageBarriers.emplace_back();
+            barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.image                           = pVkImage->GetNativeImage();
+            barrier.oldLayout                       = VK_IMAGE_LAYOUT_GENERAL;
+            barrier.newLayout                       = VK_IMAGE_LAYOUT_GENERAL;
+            barrier.srcAccessMask                   = VulkanConvert(desc.SourceAccess);
+            barrier.dstAccessMask                   = VulkanConvert(desc.DestAccess);
+            barrier.srcQueueFamilyIndex             = GetBarrierQueueFamilyIndex(desc.SourceQueueKind);
+            barrier.dstQueueFamilyIndex             = GetBarrierQueueFamilyIndex(desc.DestQueueKind);
+            barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+            barrier.subresourceRange.baseMipLevel   = 0;
+            barrier.subresourceRange.levelCount     = 1;
+            barrier.subresourceRange.baseArrayLayer = 0;
+            barrier.subresourceRange.layerCount     = 1;
+        }
+
+        m_pDeviceTable->vkCmdPipelineBarrier(m_CommandBuffer,
+                                             VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                             VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                             VK_FLAGS_NONE,
+                                             0,
+                                             nullptr,
+                                             static_cast<UInt32>(m_BufferBarriers.size()),
+                                             m_BufferBarriers.data(),
+                                             static_cast<UInt32>(m_ImageBarriers.size()),
+                                             m_ImageBarriers.data());
+    }
+
+    void VulkanCommandList::Translate(const CopyBufferCommand& command)
+    {
+        auto nativeSrc = un_verify_cast<VulkanBuffer*>(command.pSource)->GetNativeBuffer();
+        auto nativeDst = un_verify_cast<VulkanBuffer*>(command.pDestination)->GetNativeBuffer();
+
+        m_CopyRegions.clear();
+        for (auto& region : command.GetRegions())
+        {
+            auto& copy     = m_CopyRegions.emplace_back();
+            copy.size      = region.Size;
+            copy.dstOffset = region.DestOffset;
+            copy.srcOffset = region.SourceOffset;
+        }
+
+        m_pDeviceTable->vkCmdCopyBuffer(m_CommandBuffer,
+                                        nativeSrc,
+                                        nativeDst,
+                                        static_cast<UInt32>(m_CopyRegions.size()),
+                                        m_CopyRegions.data());
+    }
+
+    void VulkanCommandList::Translate(const CopyBufferToImageCommand& command)
+    {
+        auto* pImage = un_verify_cast<VulkanImage*>(command.pDestination);
+
+        auto nativeSrc = un_verify_cast<VulkanBuffer*>(command.pSource)->GetNativeBuffer();
+        auto copy      = GetBufferImageCopy(command.Region);
+        m_pDeviceTable->vkCmdCopyBufferToImage(m_CommandBuffer,
+                                               nativeSrc,
+                                               pImage->GetNativeImage(), VK_IMAGE_LAYOUT_GENERAL, 1, &copy);
+    }
+
+    void VulkanCommandList::Translate(const CopyImageToBufferCommand& command)
+    {
+        auto* pImage = un_verify_cast<VulkanImage*>(command.pSource);
+
+        auto nativeDst = un_verify_cast<VulkanBuffer*>(command.pDestination)->GetNativeBuffer();
+        auto copy      = GetBufferImageCopy(command.Region);
+        m_pDeviceTable->vkCmdCopyImageToBuffer(m_CommandBuffer,
+                                               pImage->GetNativeImage(), VK_IMAGE_LAYOUT_GENERAL, nativeDst, 1, &copy);
+    }
+
+    void VulkanCommandList::Translate(const FillCommand& command)
+    {
+        auto nativeBuffer = un_verify_cast<VulkanBuffer*>(command.pBuffer)->GetNativeBuffer();
+        m_pDeviceTable->vkCmdFillBuffer(m_CommandBuffer, nativeBuffer, command.Offset, command.Size, command.Value);
+    }
+
+    void VulkanCommandList::Translate(const UpdateCommand& command)
+    {
+        auto nativeBuffer = un_verify_cast<VulkanBuffer*>(command.pBuffer)->GetNativeBuffer();
+        m_pDeviceTable->vkCmdUpdateBuffer(m_CommandBuffer, nativeBuffer, command.Offset, command.Size, command.GetData());
+    }
+
+    void VulkanCommandList::Translate(const DispatchCommand& command)
+    {
+        BindKernel(un_verify_cast<VulkanKernel*>(command.pKernel));
+        m_pDeviceTable->vkCmdDispatch(m_CommandBuffer, command.X, command.Y, command.Z);
+    }
+
+    void VulkanCommandList::Translate(const DispatchIndirectCommand& command)
+    {
+        UN_Assert(command.pArgsBuffer->GetDesc().Usage == BufferUsage::Indirect,
+                  "Buffer \"{}\" must be created with BufferUsage::Indirect to store indirect dispatch arguments",
+                  command.pArgsBuffer->GetDebugName());
+
+        BindKernel(un_verify_cast<VulkanKernel*>(command.pKernel));
+        m_pDeviceTable->vkCmdDispatchIndirect(m_CommandBuffer,
+                                              un_verify_cast<VulkanBuffer*>(command.pArgsBuffer)->GetNativeBuffer(),
+                                              command.Offset);
+    }
+
+    void VulkanCommandList::Translate(const WriteTimestampCommand& command)
+    {
+        m_pDeviceTable->vkCmdWriteTimestamp(m_CommandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_TimestampQueryPool,
+                                            command.Index);
     }
 } // namespace UN
@@ -5,11 +5,41 @@
 
 namespace UN
 {
+    class VulkanKernel;
+    class VulkanImage;
+
     class VulkanCommandList final : public CommandListBase
     {
-        VkCommandBuffer m_CommandBuffer = VK_NULL_HANDLE;
-        VkCommandPool m_CommandPool     = VK_NULL_HANDLE;
-        VkQueue m_Queue                 = VK_NULL_HANDLE;
+        VkCommandBuffer m_CommandBuffer       = VK_NULL_HANDLE;
+        VkCommandPool m_CommandPool           = VK_NULL_HANDLE;
+        VkQueue m_Queue                       = VK_NULL_HANDLE;
+        UInt32 m_QueueFamilyIndex             = 0;
+        VkQueryPool m_TimestampQueryPool      = VK_NULL_HANDLE;
+        const VolkDeviceTable* m_pDeviceTable = nullptr;
+
+        // State bound by the commands translated so far, used to skip redundant binds.
+        VkPipeline m_BoundPipeline             = VK_NULL_HANDLE;
+        VkPipelineLayout m_BoundPipelineLayout = VK_NULL_HANDLE;
+        VkDescriptorSet m_BoundDescriptorSet   = VK_NULL_HANDLE;
+
+        std::vector<VkBufferCopy> m_CopyRegions;
+        std::vector<VkBufferMemoryBarrier> m_BufferBarriers;
+        std::vector<VkImageMemoryBarrier> m_ImageBarriers;
+
+        void BindKernel(VulkanKernel* pKernel);
+        VkBufferImageCopy GetBufferImageCopy(const BufferImageCopyRegion& region);
+        UInt32 GetBarrierQueueFamilyIndex(HardwareQueueKindFlags queueKind);
+
+        void TranslateCommands();
+        void Translate(const MemoryBarrierCommand& command);
+        void Translate(const CopyBufferCommand& command);
+        void Translate(const CopyBufferToImageCommand& command);
+        void Translate(const CopyImageToBufferCommand& command);
+        void Translate(const FillCommand& command);
+        void Translate(const UpdateCommand& command);
+        void Translate(const DispatchCommand& command);
+        void Translate(const DispatchIndirectCommand& command);
+        void Translate(const WriteTimestampCommand& command);
 
     protected:
         ResultCode InitInternal(const CommandListDesc& desc) override;
@@ -17,10 +47,8 @@ namespace UN
         ResultCode EndInternal() override;
         ResultCode ResetStateInternal() override;
         ResultCode SubmitInternal() override;
-
-        void CmdMemoryBarrier(IBuffer* pBuffer, const MemoryBarrierDesc& barrierDesc) override;
-        void CmdCopy(IBuffer* pSource, IBuffer* pDestination, const BufferCopyRegion& region) override;
-        void CmdDispatch(IKernel* pKernel, Int32 x, Int32 y, Int32 z) override;
+        ResultCode WatchCompletionInternal(CommandListCompletionCallback callback, void* pUserData) override;
+        ResultCode GetTimestampsInternal(ArraySlice<UInt64> timestamps) override;
 
     public:
         explicit VulkanCommandList(IComputeDevice* pDevice);
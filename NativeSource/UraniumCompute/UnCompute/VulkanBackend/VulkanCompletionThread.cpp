@@ -0,0 +1,94 @@
+#include <UnCompute/VulkanBackend/VulkanCompletionThread.h>
+#include <limits>
+
+namespace UN
+{
+    VulkanCompletionThread::~VulkanCompletionThread()
+    {
+        Stop();
+    }
+
+    void VulkanCompletionThread::Init(VkDevice nativeDevice, const VolkDeviceTable* pDeviceTable)
+    {
+        m_NativeDevice = nativeDevice;
+        m_pDeviceTable = pDeviceTable;
+    }
+
+    void VulkanCompletionThread::Stop()
+    {
+        {
+            std::lock_guard lock(m_Mutex);
+            m_StopRequested = true;
+        }
+
+        m_Condition.notify_all();
+        if (m_Thread.joinable())
+        {
+            UN_Assert(m_Thread.get_id() != std::this_thread::get_id(),
+                      "Completion callbacks must not release the last reference to the compute device");
+            m_Thread.join();
+        }
+
+        // Nothing waits for these fences anymore, so the callbacks must be called here to release their user data.
+        std::deque<PendingSubmission> aborted;
+        {
+            std::lock_guard lock(m_Mutex);
+            aborted.swap(m_Pending);
+            m_StopRequested = false;
+        }
+
+        UN_Warning(aborted.empty(), "Stopped the completion thread with {} command lists still pending", aborted.size());
+        for (auto& submission : aborted)
+        {
+            submission.Callback(submission.pCommandList, ResultCode::Abort, submission.pUserData);
+        }
+    }
+
+    void VulkanCompletionThread::Add(VkFence fence, ICommandList* pCommandList, CommandListCompletionCallback callback,
+                                     void* pUserData)
+    {
+        {
+            std::lock_guard lock(m_Mutex);
+            m_Pending.push_back(PendingSubmission{ fence, pCommandList, callback, pUserData });
+            if (!m_Thread.joinable())
+            {
+                m_Thread = std::thread([this] {
+                    Run();
+                });
+            }
+        }
+
+        m_Condition.notify_one();
+    }
+
+    void VulkanCompletionThread::Run()
+    {
+        while (true)
+        {
+            PendingSubmission submission;
+            {
+                std::unique_lock lock(m_Mutex);
+                m_Condition.wait(lock, [this] {
+                    return m_StopRequested || !m_Pending.empty();
+                });
+
+                if (m_StopRequested)
+                {
+                    return;
+                }
+
+                submission = m_Pending.front();
+            }
+
+            auto waitResult = m_pDeviceTable->vkWaitForFences(
+                m_NativeDevice, 1, &submission.Fence, VK_TRUE, std::numeric_limits<UInt64>::max());
+
+            {
+                std::lock_guard lock(m_Mutex);
+                m_Pending.pop_front();
+            }
+
+            submission.Callback(submission.pCommandList, VulkanConvert(waitResult), submission.pUserData);
+        }
+    }
+} // namespace UN
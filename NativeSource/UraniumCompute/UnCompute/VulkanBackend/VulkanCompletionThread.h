@@ -0,0 +1,66 @@
+#pragma once
+#include <UnCompute/Backend/ICommandList.h>
+#include <UnCompute/VulkanBackend/VulkanInclude.h>
+#include <condition_variable>
+#include <mutex>
+#include <deque>
+#include <thread>
+
+namespace UN
+{
+    //! \brief A thread that waits for the fences of command lists submitted to a single queue and calls their completion
+    //!        callbacks.
+    //!
+    //! A fence signal operation waits for all the work submitted earlier to the same queue, so the fences are signaled
+    //! in submission order and the thread only waits for the oldest pending one, without a timeout. When nothing is
+    //! pending, the thread sleeps until Add() wakes it up. The thread is only started when the first callback is
+    //! registered.
+    class VulkanCompletionThread final
+    {
+        struct PendingSubmission
+        {
+            VkFence Fence;
+            ICommandList* pCommandList;
+            CommandListCompletionCallback Callback;
+            void* pUserData;
+        };
+
+        VkDevice m_NativeDevice               = VK_NULL_HANDLE;
+        const VolkDeviceTable* m_pDeviceTable = nullptr;
+
+        std::thread m_Thread;
+        std::mutex m_Mutex;
+        std::condition_variable m_Condition;
+        std::deque<PendingSubmission> m_Pending;
+        bool m_StopRequested = false;
+
+        void Run();
+
+    public:
+        inline VulkanCompletionThread() = default;
+        ~VulkanCompletionThread();
+
+        VulkanCompletionThread(const VulkanCompletionThread&)            = delete;
+        VulkanCompletionThread& operator=(const VulkanCompletionThread&) = delete;
+
+        //! \brief Set the device to wait on, must be called before any callbacks are registered.
+        void Init(VkDevice nativeDevice, const VolkDeviceTable* pDeviceTable);
+
+        //! \brief Stop the thread.
+        //!
+        //! Waits for the fence the thread is currently waiting for, the callbacks of the command lists that are still
+        //! pending after that are called with ResultCode::Abort.
+        void Stop();
+
+        //! \brief Register a callback to call when the fence is signaled.
+        //!
+        //! The fences should be registered in the order the command lists were submitted to the queue, otherwise
+        //! the callbacks of the earlier submissions are delayed until the later ones are complete.
+        //!
+        //! \param fence        - The fence the command list signals on completion.
+        //! \param pCommandList - The submitted command list.
+        //! \param callback     - The function to call.
+        //! \param pUserData    - User data to pass to the callback.
+        void Add(VkFence fence, ICommandList* pCommandList, CommandListCompletionCallback callback, void* pUserData);
+    };
+} // namespace UN
@@ -4,10 +4,13 @@
 #include <UnCompute/VulkanBackend/VulkanComputeDevice.h>
 #include <UnCompute/VulkanBackend/VulkanDescriptorAllocator.h>
 #include <UnCompute/VulkanBackend/VulkanDeviceFactory.h>
+#include <UnCompute/VulkanBackend/VulkanDeviceFeatures.h>
 #include <UnCompute/VulkanBackend/VulkanDeviceMemory.h>
 #include <UnCompute/VulkanBackend/VulkanFence.h>
+#include <UnCompute/VulkanBackend/VulkanImage.h>
 #include <UnCompute/VulkanBackend/VulkanKernel.h>
 #include <UnCompute/VulkanBackend/VulkanResourceBinding.h>
+#include <UnCompute/VulkanBackend/VulkanSampler.h>
 #include <algorithm>
 
 namespace UN
@@ -59,14 +62,28 @@ namespace UN
         }
     }
 
-    ResultCode VulkanComputeDevice::FindMemoryType(UInt32 typeBits, VkMemoryPropertyFlags properties, UInt32& memoryType)
+    void VulkanComputeDevice::SetDebugName(VkObjectType objectType, UInt64 objectHandle, std::string_view name) const
     {
-        VkPhysicalDeviceMemoryProperties memProperties;
-        vkGetPhysicalDeviceMemoryProperties(m_NativeAdapter, &memProperties);
+        if (!m_DebugNamesEnabled || name.empty() || objectHandle == 0)
+        {
+            return;
+        }
+
+        std::string nameString(name);
 
-        for (UInt32 i = 0; i < memProperties.memoryTypeCount; ++i)
+        VkDebugUtilsObjectNameInfoEXT nameInfo{};
+        nameInfo.sType        = VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT;
+        nameInfo.objectType   = objectType;
+        nameInfo.objectHandle = objectHandle;
+        nameInfo.pObjectName  = nameString.c_str();
+        vkSetDebugUtilsObjectNameEXT(m_NativeDevice, &nameInfo);
+    }
+
+    ResultCode VulkanComputeDevice::FindMemoryType(UInt32 typeBits, VkMemoryPropertyFlags properties, UInt32& memoryType)
+    {
+        for (UInt32 i = 0; i < m_MemoryProperties.memoryTypeCount; ++i)
         {
-            if ((typeBits & (1 << i)) && (memProperties.memoryTypes[i].propertyFlags & properties) == properties)
+            if ((typeBits & (1 << i)) && (m_MemoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
             {
                 memoryType = i;
                 return ResultCode::Success;
@@ -77,11 +94,115 @@ namespace UN
         return ResultCode::Fail;
     }
 
+    ResultCode VulkanComputeDevice::InitializeImageLayout(VkImage image)
+    {
+        // A transient pool is used, so that the transition doesn't use the pools of command lists recorded concurrently.
+        auto queueFamilyIndex = GetQueueFamilyIndex(HardwareQueueKindFlags::Compute);
+
+        VkCommandPoolCreateInfo poolCI{};
+        poolCI.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolCI.queueFamilyIndex = queueFamilyIndex;
+        poolCI.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+        VkCommandPool commandPool;
+        if (auto vkResult = m_DeviceTable.vkCreateCommandPool(m_NativeDevice, &poolCI, nullptr, &commandPool); Failed(vkResult))
+        {
+            UN_Error(false, "Couldn't create a command pool for image layout transition, vkCreateCommandPool returned {}",
+                     vkResult);
+            return VulkanConvert(vkResult);
+        }
+
+        VkCommandBufferAllocateInfo allocateInfo{};
+        allocateInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocateInfo.commandPool        = commandPool;
+        allocateInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocateInfo.commandBufferCount = 1;
+
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        VkFence fence                 = VK_NULL_HANDLE;
+        auto vkResult                 = m_DeviceTable.vkAllocateCommandBuffers(m_NativeDevice, &allocateInfo, &commandBuffer);
+        if (Succeeded(vkResult))
+        {
+            VkCommandBufferBeginInfo beginInfo{};
+            beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            vkResult        = m_DeviceTable.vkBeginCommandBuffer(commandBuffer, &beginInfo);
+        }
+
+        if (Succeeded(vkResult))
+        {
+            VkImageMemoryBarrier barrier{};
+            barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.image                           = image;
+            barrier.oldLayout                       = VK_IMAGE_LAYOUT_UNDEFINED;
+            barrier.newLayout                       = VK_IMAGE_LAYOUT_GENERAL;
+            barrier.srcAccessMask                   = VK_FLAGS_NONE;
+            barrier.dstAccessMask                   = VK_FLAGS_NONE;
+            barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+            barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+            barrier.subresourceRange.baseMipLevel   = 0;
+            barrier.subresourceRange.levelCount     = 1;
+            barrier.subresourceRange.baseArrayLayer = 0;
+            barrier.subresourceRange.layerCount     = 1;
+
+            m_DeviceTable.vkCmdPipelineBarrier(commandBuffer,
+                                               VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                               VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                               VK_FLAGS_NONE,
+                                               0,
+                                               nullptr,
+                                               0,
+                                               nullptr,
+                                               1,
+                                               &barrier);
+            vkResult = m_DeviceTable.vkEndCommandBuffer(commandBuffer);
+        }
+
+        if (Succeeded(vkResult))
+        {
+            VkFenceCreateInfo fenceCI{};
+            fenceCI.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            vkResult      = m_DeviceTable.vkCreateFence(m_NativeDevice, &fenceCI, nullptr, &fence);
+        }
+
+        if (Succeeded(vkResult))
+        {
+            VkSubmitInfo submitInfo{};
+            submitInfo.sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.commandBufferCount = 1;
+            submitInfo.pCommandBuffers    = &commandBuffer;
+            vkResult = m_DeviceTable.vkQueueSubmit(GetDeviceQueue(queueFamilyIndex, 0), 1, &submitInfo, fence);
+        }
+
+        // The transition completes before the image can be used in any command list submitted later.
+        if (Succeeded(vkResult))
+        {
+            vkResult = m_DeviceTable.vkWaitForFences(m_NativeDevice, 1, &fence, true, std::numeric_limits<UInt64>::max());
+        }
+
+        if (fence != VK_NULL_HANDLE)
+        {
+            m_DeviceTable.vkDestroyFence(m_NativeDevice, fence, nullptr);
+        }
+
+        m_DeviceTable.vkDestroyCommandPool(m_NativeDevice, commandPool, nullptr);
+        if (Failed(vkResult))
+        {
+            UN_Error(false, "Couldn't transition image to VK_IMAGE_LAYOUT_GENERAL, Vulkan returned {}", vkResult);
+        }
+
+        return VulkanConvert(vkResult);
+    }
+
     ResultCode VulkanComputeDevice::Init(const ComputeDeviceDesc& desc)
     {
-        m_NativeAdapter                         = m_pFactory->GetVulkanAdapters()[desc.AdapterId];
-        [[maybe_unused]] auto adapterProperties = m_pFactory->GetVulkanAdapterProperties()[desc.AdapterId];
+        m_NativeAdapter        = m_pFactory->GetVulkanAdapters()[desc.AdapterId];
+        m_AdapterInfo          = m_pFactory->EnumerateAdapters()[desc.AdapterId];
+        auto adapterProperties = m_pFactory->GetVulkanAdapterProperties()[desc.AdapterId];
+        m_Limits               = adapterProperties.limits;
 
+        vkGetPhysicalDeviceMemoryProperties(m_NativeAdapter, &m_MemoryProperties);
         FindQueueFamilies();
 
         UInt32 availableExtCount;
@@ -91,19 +212,71 @@ namespace UN
         availableExt.resize(availableExtCount);
         vkEnumerateDeviceExtensionProperties(m_NativeAdapter, nullptr, &availableExtCount, availableExt.data());
 
-        for (auto& ext : RequiredDeviceExtensions)
-        {
-            bool found = std::any_of(availableExt.begin(), availableExt.end(), [ext](const VkExtensionProperties& props) {
+        auto isExtensionAvailable = [&availableExt](const char* ext) {
+            return std::any_of(availableExt.begin(), availableExt.end(), [ext](const VkExtensionProperties& props) {
                 return std::string_view(ext) == props.extensionName;
             });
+        };
 
-            if (!found)
+        for (auto& ext : RequiredDeviceExtensions)
+        {
+            if (!isExtensionAvailable(ext))
             {
                 UN_Error(false, "Vulkan device extension {} was not found", ext);
                 return ResultCode::Fail;
             }
         }
 
+        if (!AllFlagsActive(m_AdapterInfo.SupportedFeatures, desc.RequiredFeatures))
+        {
+            auto missingFeatures = static_cast<UInt32>(desc.RequiredFeatures & ~m_AdapterInfo.SupportedFeatures);
+            UN_Error(false, "Required device features are not supported by the adapter, missing bits: {}", missingFeatures);
+            return ResultCode::InvalidArguments;
+        }
+
+        std::vector<const char*> enabledExtensions(RequiredDeviceExtensions.begin(), RequiredDeviceExtensions.end());
+
+        VulkanDeviceFeatures deviceFeatures(adapterProperties.apiVersion);
+        deviceFeatures.SetFlags(desc.RequiredFeatures);
+
+        // The factory reports a non-zero subgroup size range only if both the extension and the feature are supported.
+        VkPhysicalDeviceSubgroupSizeControlFeaturesEXT sizeControlFeatures{};
+        sizeControlFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES_EXT;
+        if (m_AdapterInfo.MaxSubgroupSize > 0)
+        {
+            enabledExtensions.push_back(VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME);
+            sizeControlFeatures.subgroupSizeControl = VK_TRUE;
+            deviceFeatures.Append(&sizeControlFeatures);
+        }
+
+        m_MemoryBudgetSupported = isExtensionAvailable(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+        if (m_MemoryBudgetSupported)
+        {
+            enabledExtensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+        }
+
+#if UN_LINUX
+        if (isExtensionAvailable(VK_KHR_EXTERNAL_FENCE_FD_EXTENSION_NAME))
+        {
+            VkPhysicalDeviceExternalFenceInfo externalFenceInfo{};
+            externalFenceInfo.sType      = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FENCE_INFO;
+            externalFenceInfo.handleType = VK_EXTERNAL_FENCE_HANDLE_TYPE_SYNC_FD_BIT;
+
+            VkExternalFenceProperties externalFenceProperties{};
+            externalFenceProperties.sType = VK_STRUCTURE_TYPE_EXTERNAL_FENCE_PROPERTIES;
+            vkGetPhysicalDeviceExternalFenceProperties(m_NativeAdapter, &externalFenceInfo, &externalFenceProperties);
+
+            constexpr VkExternalFenceFeatureFlags requiredFeatures =
+                VK_EXTERNAL_FENCE_FEATURE_EXPORTABLE_BIT | VK_EXTERNAL_FENCE_FEATURE_IMPORTABLE_BIT;
+            m_SyncFdFencesSupported = (externalFenceProperties.externalFenceFeatures & requiredFeatures) == requiredFeatures;
+        }
+
+        if (m_SyncFdFencesSupported)
+        {
+            enabledExtensions.push_back(VK_KHR_EXTERNAL_FENCE_FD_EXTENSION_NAME);
+        }
+#endif
+
         constexpr Float32 queuePriority = 1.0f;
         std::vector<VkDeviceQueueCreateInfo> queuesCI{};
         queuesCI.reserve(m_QueueFamilies.size());
@@ -116,15 +289,14 @@ namespace UN
             queueCI.pQueuePriorities = &queuePriority;
         }
 
-        VkPhysicalDeviceFeatures deviceFeatures{};
-
         VkDeviceCreateInfo deviceCI{};
         deviceCI.sType                   = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+        deviceCI.pNext                   = &deviceFeatures.Features;
         deviceCI.queueCreateInfoCount    = static_cast<UInt32>(queuesCI.size());
         deviceCI.pQueueCreateInfos       = queuesCI.data();
-        deviceCI.pEnabledFeatures        = &deviceFeatures;
-        deviceCI.enabledExtensionCount   = static_cast<UInt32>(RequiredDeviceExtensions.size());
-        deviceCI.ppEnabledExtensionNames = RequiredDeviceExtensions.data();
+        deviceCI.pEnabledFeatures        = nullptr;
+        deviceCI.enabledExtensionCount   = static_cast<UInt32>(enabledExtensions.size());
+        deviceCI.ppEnabledExtensionNames = enabledExtensions.data();
 
         if (auto vkResult = vkCreateDevice(m_NativeAdapter, &deviceCI, nullptr, &m_NativeDevice); Failed(vkResult))
         {
@@ -132,17 +304,23 @@ namespace UN
             return VulkanConvert(vkResult);
         }
 
-        // TODO: this is not suitable for applications that use multiple VkDevice objects
-        // Ok for now, but it is possible that someday we will use more than one device in our scheduler.
-        volkLoadDevice(m_NativeDevice);
+        // Load device-level functions into a per-device table instead of volk's global function pointers,
+        // so that devices created on different adapters can be used concurrently.
+        volkLoadDeviceTable(&m_DeviceTable, m_NativeDevice);
+        m_DebugNamesEnabled = m_pFactory->IsDebugUtilsEnabled();
 
         for (auto& queue : m_QueueFamilies)
         {
+            queue.pCompletionThread = std::make_unique<VulkanCompletionThread>();
+            queue.pCompletionThread->Init(m_NativeDevice, &m_DeviceTable);
+
             VkCommandPoolCreateInfo poolCI{};
             poolCI.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
             poolCI.queueFamilyIndex = queue.FamilyIndex;
             poolCI.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-            if (auto vkResult = vkCreateCommandPool(m_NativeDevice, &poolCI, nullptr, &queue.CmdPool); Failed(vkResult))
+
+            auto vkResult = m_DeviceTable.vkCreateCommandPool(m_NativeDevice, &poolCI, nullptr, &queue.CmdPool);
+            if (Failed(vkResult))
             {
                 UN_Error(false,
                          "Couldn't create a command pool for queue family index {}, vkCreateCommandPool returned {}",
@@ -159,6 +337,7 @@ namespace UN
 
         VulkanDescriptorAllocatorDesc descriptorAllocatorDesc{};
         descriptorAllocatorDesc.Sizes[VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER] = 1.f;
+        descriptorAllocatorDesc.Sizes[VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER] = 1.f;
         descriptorAllocatorDesc.Sizes[VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER]       = 2.f;
         descriptorAllocatorDesc.Sizes[VK_DESCRIPTOR_TYPE_STORAGE_BUFFER]       = 2.f;
         descriptorAllocatorDesc.Sizes[VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE]        = 1.f;
@@ -174,6 +353,42 @@ namespace UN
         return result;
     }
 
+    ResultCode VulkanComputeDevice::GetMemoryBudget(MemoryBudget* pBudget)
+    {
+        VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProperties{};
+        budgetProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+        VkPhysicalDeviceMemoryProperties2 memoryProperties{};
+        memoryProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+        if (m_MemoryBudgetSupported)
+        {
+            memoryProperties.pNext = &budgetProperties;
+            vkGetPhysicalDeviceMemoryProperties2(m_NativeAdapter, &memoryProperties);
+        }
+
+        *pBudget           = {};
+        pBudget->HeapCount = std::min(m_MemoryProperties.memoryHeapCount, AdapterCapabilities::MaxMemoryHeaps);
+        for (UInt32 i = 0; i < pBudget->HeapCount; ++i)
+        {
+            auto& heap          = pBudget->Heaps[i];
+            heap.AllocatedBytes = m_AllocatedBytes[i].load(std::memory_order_relaxed);
+            if (m_MemoryBudgetSupported)
+            {
+                heap.Budget = budgetProperties.heapBudget[i];
+                heap.Usage  = budgetProperties.heapUsage[i];
+            }
+            else
+            {
+                heap.Budget = m_MemoryProperties.memoryHeaps[i].size;
+                heap.Usage  = heap.AllocatedBytes;
+            }
+
+            pBudget->TotalAllocatedBytes += heap.AllocatedBytes;
+        }
+
+        return ResultCode::Success;
+    }
+
     void VulkanComputeDevice::Reset()
     {
         ResetInternal();
@@ -195,14 +410,28 @@ namespace UN
     {
         UNLOG_Debug("Destroyed Vulkan device");
 
-        vkDeviceWaitIdle(m_NativeDevice);
+        if (m_NativeDevice == VK_NULL_HANDLE)
+        {
+            return;
+        }
+
+        for (auto& family : m_QueueFamilies)
+        {
+            if (family.pCompletionThread)
+            {
+                family.pCompletionThread->Stop();
+            }
+        }
+
+        m_DeviceTable.vkDeviceWaitIdle(m_NativeDevice);
 
         for (auto& family : m_QueueFamilies)
         {
-            vkDestroyCommandPool(m_NativeDevice, family.CmdPool, nullptr);
+            m_DeviceTable.vkDestroyCommandPool(m_NativeDevice, family.CmdPool, nullptr);
         }
 
-        vkDestroyDevice(m_NativeDevice, nullptr);
+        m_DeviceTable.vkDestroyDevice(m_NativeDevice, nullptr);
+        m_NativeDevice = VK_NULL_HANDLE;
     }
 
     ResultCode VulkanComputeDevice::CreateBuffer(IBuffer** ppBuffer)
@@ -210,6 +439,16 @@ namespace UN
         return VulkanBuffer::Create(this, ppBuffer);
     }
 
+    ResultCode VulkanComputeDevice::CreateImage(IImage** ppImage)
+    {
+        return VulkanImage::Create(this, ppImage);
+    }
+
+    ResultCode VulkanComputeDevice::CreateSampler(ISampler** ppSampler)
+    {
+        return VulkanSampler::Create(this, ppSampler);
+    }
+
     ResultCode VulkanComputeDevice::CreateMemory(IDeviceMemory** ppMemory)
     {
         return VulkanDeviceMemory::Create(this, ppMemory);
@@ -1,7 +1,11 @@
 #pragma once
+#include <UnCompute/Acceleration/AdapterInfo.h>
 #include <UnCompute/Backend/IComputeDevice.h>
 #include <UnCompute/Memory/Ptr.h>
+#include <UnCompute/VulkanBackend/VulkanCompletionThread.h>
 #include <UnCompute/VulkanBackend/VulkanInclude.h>
+#include <atomic>
+#include <memory>
 
 namespace UN
 {
@@ -12,6 +16,9 @@ namespace UN
         HardwareQueueKindFlags KindFlags;
         VkCommandPool CmdPool = VK_NULL_HANDLE;
 
+        //! \brief Calls completion callbacks of command lists submitted to the queue of this family.
+        std::unique_ptr<VulkanCompletionThread> pCompletionThread;
+
         inline VulkanQueueFamily(UInt32 familyIndex, UInt32 queueCount, HardwareQueueKindFlags kindFlags)
             : FamilyIndex(familyIndex)
             , QueueCount(queueCount)
@@ -31,6 +38,15 @@ namespace UN
 
         VkDevice m_NativeDevice          = VK_NULL_HANDLE;
         VkPhysicalDevice m_NativeAdapter = VK_NULL_HANDLE;
+        AdapterInfo m_AdapterInfo        = {};
+        VkPhysicalDeviceLimits m_Limits  = {};
+        VolkDeviceTable m_DeviceTable    = {};
+        bool m_DebugNamesEnabled         = false;
+        bool m_SyncFdFencesSupported     = false;
+
+        VkPhysicalDeviceMemoryProperties m_MemoryProperties                                   = {};
+        std::array<std::atomic<UInt64>, AdapterCapabilities::MaxMemoryHeaps> m_AllocatedBytes = {};
+        bool m_MemoryBudgetSupported                                                          = false;
 
         Ptr<VulkanDescriptorAllocator> m_pDescriptorAllocator;
 
@@ -46,6 +62,8 @@ namespace UN
         ResultCode Init(const DescriptorType& desc) override;
         void Reset() override;
 
+        ResultCode GetMemoryBudget(MemoryBudget* pBudget) override;
+
         inline VkCommandPool GetCommandPool(UInt32 queueFamilyIndex)
         {
             for (auto& queue : m_QueueFamilies)
@@ -77,14 +95,14 @@ namespace UN
         inline VkQueue GetDeviceQueue(UInt32 queueFamilyIndex, UInt32 queueIndex)
         {
             VkQueue queue;
-            vkGetDeviceQueue(m_NativeDevice, queueFamilyIndex, queueIndex, &queue);
+            m_DeviceTable.vkGetDeviceQueue(m_NativeDevice, queueFamilyIndex, queueIndex, &queue);
             return queue;
         }
 
         inline VkQueue GetDeviceQueue(HardwareQueueKindFlags flags)
         {
             VkQueue queue;
-            vkGetDeviceQueue(m_NativeDevice, GetQueueFamilyIndex(flags), 0, &queue);
+            m_DeviceTable.vkGetDeviceQueue(m_NativeDevice, GetQueueFamilyIndex(flags), 0, &queue);
             return queue;
         }
 
@@ -93,14 +111,94 @@ namespace UN
             return m_pDescriptorAllocator.Get();
         }
 
+        //! \brief Get the thread that calls completion callbacks of command lists submitted to a queue family.
+        inline VulkanCompletionThread& GetCompletionThread(UInt32 queueFamilyIndex)
+        {
+            for (auto& queue : m_QueueFamilies)
+            {
+                if (queue.FamilyIndex == queueFamilyIndex)
+                {
+                    return *queue.pCompletionThread;
+                }
+            }
+
+            UN_Verify(false, "Couldn't find completion thread");
+            return *m_QueueFamilies.front().pCompletionThread;
+        }
+
         ResultCode FindMemoryType(UInt32 typeBits, VkMemoryPropertyFlags properties, UInt32& memoryType);
 
+        //! \brief Transition a newly bound image from VK_IMAGE_LAYOUT_UNDEFINED to VK_IMAGE_LAYOUT_GENERAL.
+        //!
+        //! The transition is submitted separately from command lists and waited for, so every command list can use
+        //! the image in VK_IMAGE_LAYOUT_GENERAL regardless of the order they are recorded and submitted in.
+        //!
+        //! \param image - The image to transition.
+        //!
+        //! \return ResultCode::Success or an error code.
+        ResultCode InitializeImageLayout(VkImage image);
+
+        //! \brief Called by VulkanDeviceMemory to keep track of the allocated bytes per memory heap.
+        inline void OnMemoryAllocated(UInt32 memoryTypeIndex, UInt64 size)
+        {
+            m_AllocatedBytes[m_MemoryProperties.memoryTypes[memoryTypeIndex].heapIndex] += size;
+        }
+
+        //! \brief Called by VulkanDeviceMemory to keep track of the allocated bytes per memory heap.
+        inline void OnMemoryFreed(UInt32 memoryTypeIndex, UInt64 size)
+        {
+            m_AllocatedBytes[m_MemoryProperties.memoryTypes[memoryTypeIndex].heapIndex] -= size;
+        }
+
+        //! \brief Assign a debug name to a Vulkan object created on this device.
+        //!
+        //! Does nothing unless the device factory profile enables validation, so that production builds don't pay
+        //! for the names.
+        //!
+        //! \param objectType   - Type of the Vulkan object.
+        //! \param objectHandle - Handle of the Vulkan object.
+        //! \param name         - Debug name to assign.
+        void SetDebugName(VkObjectType objectType, UInt64 objectHandle, std::string_view name) const;
+
+        //! \brief Check if fences can be exported to and imported from Linux sync file descriptors.
+        [[nodiscard]] inline bool AreSyncFdFencesSupported() const
+        {
+            return m_SyncFdFencesSupported;
+        }
+
         [[nodiscard]] inline VkDevice GetNativeDevice() const
         {
             return m_NativeDevice;
         }
 
+        //! \brief Get the table of device-level Vulkan functions loaded for this device.
+        //!
+        //! Device-level Vulkan commands should be called through this table. The global volk function pointers loaded by
+        //! volkLoadInstance() also work, but they go through the loader dispatch on every call.
+        [[nodiscard]] inline const VolkDeviceTable& GetDeviceTable() const
+        {
+            return m_DeviceTable;
+        }
+
+        [[nodiscard]] inline VkPhysicalDevice GetNativeAdapter() const
+        {
+            return m_NativeAdapter;
+        }
+
+        [[nodiscard]] inline const AdapterInfo& GetAdapterInfo() const override
+        {
+            return m_AdapterInfo;
+        }
+
+        //! \brief Get the limits of the adapter the device was created on.
+        [[nodiscard]] inline const VkPhysicalDeviceLimits& GetLimits() const
+        {
+            return m_Limits;
+        }
+
         ResultCode CreateBuffer(IBuffer** ppBuffer) override;
+        ResultCode CreateImage(IImage** ppImage) override;
+        ResultCode CreateSampler(ISampler** ppSampler) override;
         ResultCode CreateMemory(IDeviceMemory** ppMemory) override;
         ResultCode CreateFence(IFence** ppFence) override;
         ResultCode CreateCommandList(ICommandList** ppCommandList) override;
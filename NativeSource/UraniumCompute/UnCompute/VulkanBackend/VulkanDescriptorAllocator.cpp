@@ -16,15 +16,17 @@ namespace UN
 
     void VulkanDescriptorAllocator::Reset()
     {
-        auto vkDevice = m_pDevice.As<VulkanComputeDevice>()->GetNativeDevice();
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
         for (auto pool : m_FreePools)
         {
-            vkDestroyDescriptorPool(vkDevice, pool, nullptr);
+            deviceTable.vkDestroyDescriptorPool(vkDevice, pool, nullptr);
         }
 
         for (auto pool : m_UsedPools)
         {
-            vkDestroyDescriptorPool(vkDevice, pool, nullptr);
+            deviceTable.vkDestroyDescriptorPool(vkDevice, pool, nullptr);
         }
     }
 
@@ -36,7 +38,9 @@ namespace UN
 
     ResultCode VulkanDescriptorAllocator::AllocateSet(VkDescriptorSetLayout setLayout, VkDescriptorSet* pDescriptorSet)
     {
-        auto vkDevice = m_pDevice.As<VulkanComputeDevice>()->GetNativeDevice();
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
         if (m_CurrentPool == VK_NULL_HANDLE)
         {
             m_CurrentPool = GetPool();
@@ -49,7 +53,7 @@ namespace UN
         setAI.descriptorPool     = m_CurrentPool;
         setAI.descriptorSetCount = 1;
 
-        auto result = vkAllocateDescriptorSets(vkDevice, &setAI, pDescriptorSet);
+        auto result       = deviceTable.vkAllocateDescriptorSets(vkDevice, &setAI, pDescriptorSet);
         if (Succeeded(result))
         {
             return ResultCode::Success;
@@ -60,7 +64,7 @@ namespace UN
             m_CurrentPool        = GetPool();
             setAI.descriptorPool = m_CurrentPool;
 
-            result = vkAllocateDescriptorSets(vkDevice, &setAI, pDescriptorSet);
+            result = deviceTable.vkAllocateDescriptorSets(vkDevice, &setAI, pDescriptorSet);
             if (Succeeded(result))
             {
                 return ResultCode::Success;
@@ -94,8 +98,10 @@ namespace UN
         poolCI.pPoolSizes    = sizes.data();
 
         VkDescriptorPool descriptorPool;
-        auto vkDevice = m_pDevice.As<VulkanComputeDevice>()->GetNativeDevice();
-        auto result   = vkCreateDescriptorPool(vkDevice, &poolCI, nullptr, &descriptorPool);
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+        auto result       = deviceTable.vkCreateDescriptorPool(vkDevice, &poolCI, nullptr, &descriptorPool);
         UN_Assert(Succeeded(result), "Couldn't create a Vulkan descriptor pool, vkCreateDescriptorPool returned {}", result);
 
         return descriptorPool;
@@ -122,10 +128,12 @@ namespace UN
 
     void VulkanDescriptorAllocator::ResetPools()
     {
-        auto vkDevice = m_pDevice.As<VulkanComputeDevice>()->GetNativeDevice();
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
         for (auto pool : m_UsedPools)
         {
-            vkResetDescriptorPool(vkDevice, pool, VK_FLAGS_NONE);
+            deviceTable.vkResetDescriptorPool(vkDevice, pool, VK_FLAGS_NONE);
         }
 
         m_FreePools = m_UsedPools;
@@ -2,14 +2,13 @@
 #include <UnCompute/Memory/Memory.h>
 #include <UnCompute/VulkanBackend/VulkanComputeDevice.h>
 #include <UnCompute/VulkanBackend/VulkanDeviceFactory.h>
+#include <UnCompute/VulkanBackend/VulkanDeviceFeatures.h>
 #include <algorithm>
 #include <iostream>
 
-constexpr auto RequiredInstanceLayers = std::array{ "VK_LAYER_KHRONOS_validation",
-                                                    /*"VK_LAYER_LUNARG_standard_validation"*/
-};
+constexpr auto ValidationLayerName = "VK_LAYER_KHRONOS_validation";
 
-[[maybe_unused]] static VKAPI_ATTR VkBool32 VKAPI_CALL DebugReportCallback(VkDebugReportFlagsEXT flags,
+static VKAPI_ATTR VkBool32 VKAPI_CALL DebugReportCallback(VkDebugReportFlagsEXT flags,
                                                                            VkDebugReportObjectTypeEXT /* objectType */,
                                                                            UN::UInt64 /* object */, size_t /* location */,
                                                                            UN::Int32 /* messageCode */, const char* pLayerPrefix,
@@ -52,56 +51,211 @@ constexpr auto RequiredInstanceLayers = std::array{ "VK_LAYER_KHRONOS_validation
 
 namespace UN
 {
+    static bool IsDeviceExtensionSupported(VkPhysicalDevice adapter, const char* extension)
+    {
+        UInt32 extensionCount;
+        vkEnumerateDeviceExtensionProperties(adapter, nullptr, &extensionCount, nullptr);
+        std::vector<VkExtensionProperties> extensions(extensionCount, VkExtensionProperties{});
+        vkEnumerateDeviceExtensionProperties(adapter, nullptr, &extensionCount, extensions.data());
+
+        auto extSlice = std::string_view(extension);
+        return std::any_of(extensions.begin(), extensions.end(), [&](const VkExtensionProperties& props) {
+            return extSlice == props.extensionName;
+        });
+    }
+
+    //! \brief Get the newest shader model whose compute features the adapter supports.
+    //!
+    //! Only the models gated by device features are reported: SM6_6 needs 64-bit atomics and SM6_2 needs native 16-bit
+    //! types. The intrinsics of the other models depend on optional SPIR-V extensions, so they are never reported.
+    static KernelShaderModel GetShaderModel(UInt32 apiVersion, DeviceFeatureFlags features)
+    {
+        if (apiVersion >= VK_API_VERSION_1_2 && AllFlagsActive(features, DeviceFeatureFlags::Int64Atomics))
+        {
+            return KernelShaderModel::SM6_6;
+        }
+
+        if (AnyFlagsActive(features, DeviceFeatureFlags::Float16 | DeviceFeatureFlags::Int16))
+        {
+            return KernelShaderModel::SM6_2;
+        }
+
+        return KernelShaderModel::SM6_0;
+    }
+
+    static void GetSubgroupInfo(VkPhysicalDevice adapter, AdapterInfo& info)
+    {
+        bool sizeControlSupported = IsDeviceExtensionSupported(adapter, VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME);
+
+        VkPhysicalDeviceSubgroupSizeControlPropertiesEXT sizeControlProps{};
+        sizeControlProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES_EXT;
+
+        VkPhysicalDeviceSubgroupProperties subgroupProps{};
+        subgroupProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES;
+        subgroupProps.pNext = sizeControlSupported ? &sizeControlProps : nullptr;
+
+        VkPhysicalDeviceProperties2 props{};
+        props.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        props.pNext = &subgroupProps;
+        vkGetPhysicalDeviceProperties2(adapter, &props);
+
+        VkPhysicalDeviceSubgroupSizeControlFeaturesEXT sizeControlFeatures{};
+        sizeControlFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES_EXT;
+        if (sizeControlSupported)
+        {
+            VkPhysicalDeviceFeatures2 features{};
+            features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+            features.pNext = &sizeControlFeatures;
+            vkGetPhysicalDeviceFeatures2(adapter, &features);
+        }
+
+        // SubgroupOperationFlags bits match VkSubgroupFeatureFlagBits, vendor-specific bits are masked out.
+        constexpr VkSubgroupFeatureFlags supportedOperationsMask = VK_SUBGROUP_FEATURE_QUAD_BIT * 2 - 1;
+
+        info.SubgroupSize       = subgroupProps.subgroupSize;
+        info.SubgroupOperations = SubgroupOperationFlags::None;
+        if (subgroupProps.supportedStages & VK_SHADER_STAGE_COMPUTE_BIT)
+        {
+            auto operations         = subgroupProps.supportedOperations & supportedOperationsMask;
+            info.SubgroupOperations = static_cast<SubgroupOperationFlags>(operations);
+        }
+
+        info.MinSubgroupSize = 0;
+        info.MaxSubgroupSize = 0;
+        bool computeSizeControl = sizeControlProps.requiredSubgroupSizeStages & VK_SHADER_STAGE_COMPUTE_BIT;
+        if (sizeControlFeatures.subgroupSizeControl && computeSizeControl)
+        {
+            info.MinSubgroupSize = sizeControlProps.minSubgroupSize;
+            info.MaxSubgroupSize = sizeControlProps.maxSubgroupSize;
+        }
+    }
+
     ResultCode VulkanDeviceFactory::Init(const DeviceFactoryDesc& desc)
     {
         volkInitialize();
-        UInt32 layerCount;
-        vkEnumerateInstanceLayerProperties(&layerCount, nullptr);
-        std::vector<VkLayerProperties> layers(layerCount, VkLayerProperties{});
-        vkEnumerateInstanceLayerProperties(&layerCount, layers.data());
-        for (auto& layer : RequiredInstanceLayers)
+        m_Profile         = desc.Profile;
+        bool debugEnabled = desc.Profile != DeviceFactoryProfile::Production;
+
+        std::vector<const char*> enabledLayers;
+        if (debugEnabled)
         {
-            auto layerSlice = std::string_view(layer);
+            UInt32 layerCount;
+            vkEnumerateInstanceLayerProperties(&layerCount, nullptr);
+            std::vector<VkLayerProperties> layers(layerCount, VkLayerProperties{});
+            vkEnumerateInstanceLayerProperties(&layerCount, layers.data());
+
+            auto layerSlice = std::string_view(ValidationLayerName);
             bool found      = std::any_of(layers.begin(), layers.end(), [&](const VkLayerProperties& props) {
                 return layerSlice == props.layerName;
             });
-            if (!found)
+            if (found)
             {
-                UN_Assert(found, "Vulkan instance layer not found");
-                return ResultCode::Fail;
+                enabledLayers.push_back(ValidationLayerName);
             }
+
+            UN_Warning(found, "Vulkan instance layer '{}' not found, validation is disabled", ValidationLayerName);
         }
 
-        UInt32 extensionCount;
-        vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, nullptr);
-        std::vector<VkExtensionProperties> extensions(extensionCount, VkExtensionProperties{});
-        vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, extensions.data());
-        for (auto& ext : RequiredInstanceExtensions)
+        std::vector<VkExtensionProperties> extensions;
+        auto appendExtensions = [&extensions](const char* pLayerName) {
+            UInt32 extensionCount;
+            vkEnumerateInstanceExtensionProperties(pLayerName, &extensionCount, nullptr);
+            auto offset = extensions.size();
+            extensions.resize(offset + extensionCount, VkExtensionProperties{});
+            vkEnumerateInstanceExtensionProperties(pLayerName, &extensionCount, extensions.data() + offset);
+        };
+
+        appendExtensions(nullptr);
+        for (auto* pLayerName : enabledLayers)
         {
-            auto extSlice = std::string_view(ext);
-            bool found    = std::any_of(extensions.begin(), extensions.end(), [&](const VkExtensionProperties& props) {
+            // Layers can provide their own extensions, e.g. VK_EXT_validation_features.
+            appendExtensions(pLayerName);
+        }
+
+        auto isExtensionAvailable = [&extensions](const char* extension) {
+            auto extSlice = std::string_view(extension);
+            return std::any_of(extensions.begin(), extensions.end(), [&](const VkExtensionProperties& props) {
                 return extSlice == props.extensionName;
             });
-            if (!found)
+        };
+
+        std::vector<const char*> enabledExtensions;
+        for (auto& ext : RequiredInstanceExtensions)
+        {
+            if (!isExtensionAvailable(ext))
             {
-                UN_Assert(found, "Vulkan instance extension '{}' not found", ext);
+                UN_Assert(false, "Vulkan instance extension '{}' not found", ext);
                 return ResultCode::Fail;
             }
+
+            enabledExtensions.push_back(ext);
         }
 
+        if (debugEnabled)
+        {
+            for (auto& ext : DebugInstanceExtensions)
+            {
+                if (isExtensionAvailable(ext))
+                {
+                    enabledExtensions.push_back(ext);
+                }
+            }
+        }
+
+        auto isExtensionEnabled = [&enabledExtensions](const char* extension) {
+            return std::any_of(enabledExtensions.begin(), enabledExtensions.end(), [extension](const char* ext) {
+                return std::string_view(extension) == ext;
+            });
+        };
+
+        m_DebugUtilsEnabled = isExtensionEnabled(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+
+        VkValidationFeatureEnableEXT validationFeatures[2];
+        VkValidationFeaturesEXT validationFeaturesInfo{};
+        validationFeaturesInfo.sType                         = VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT;
+        validationFeaturesInfo.pEnabledValidationFeatures    = validationFeatures;
+        validationFeaturesInfo.enabledValidationFeatureCount = 0;
+        if (desc.Profile == DeviceFactoryProfile::GpuAssistedValidation)
+        {
+            validationFeatures[validationFeaturesInfo.enabledValidationFeatureCount++] =
+                VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_EXT;
+            validationFeatures[validationFeaturesInfo.enabledValidationFeatureCount++] =
+                VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_RESERVE_BINDING_SLOT_EXT;
+        }
+        else if (desc.Profile == DeviceFactoryProfile::SynchronizationValidation)
+        {
+            validationFeatures[validationFeaturesInfo.enabledValidationFeatureCount++] =
+                VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT;
+        }
+
+        bool validationFeaturesEnabled = false;
+        if (validationFeaturesInfo.enabledValidationFeatureCount > 0 && !enabledLayers.empty())
+        {
+            validationFeaturesEnabled = isExtensionAvailable(VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME);
+            UN_Warning(validationFeaturesEnabled,
+                       "Vulkan instance extension '{}' not found, only the standard validation is enabled",
+                       VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME);
+            if (validationFeaturesEnabled)
+            {
+                enabledExtensions.push_back(VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME);
+            }
+        }
+
+        // The highest version the library can use, devices use the lower of this and the adapter's version.
         VkApplicationInfo appInfo{};
         appInfo.sType            = VK_STRUCTURE_TYPE_APPLICATION_INFO;
-        appInfo.apiVersion       = VK_API_VERSION_1_2;
+        appInfo.apiVersion       = VK_API_VERSION_1_3;
         appInfo.pEngineName      = "UraniumCompute";
         appInfo.pApplicationName = desc.ApplicationName;
 
         VkInstanceCreateInfo instanceCI{};
         instanceCI.sType                   = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+        instanceCI.pNext                   = validationFeaturesEnabled ? &validationFeaturesInfo : nullptr;
         instanceCI.pApplicationInfo        = &appInfo;
-        instanceCI.enabledLayerCount       = static_cast<UInt32>(RequiredInstanceLayers.size());
-        instanceCI.ppEnabledLayerNames     = RequiredInstanceLayers.data();
-        instanceCI.enabledExtensionCount   = static_cast<UInt32>(RequiredInstanceExtensions.size());
-        instanceCI.ppEnabledExtensionNames = RequiredInstanceExtensions.data();
+        instanceCI.enabledLayerCount       = static_cast<UInt32>(enabledLayers.size());
+        instanceCI.ppEnabledLayerNames     = enabledLayers.data();
+        instanceCI.enabledExtensionCount   = static_cast<UInt32>(enabledExtensions.size());
+        instanceCI.ppEnabledExtensionNames = enabledExtensions.data();
 
         if (auto vkResult = vkCreateInstance(&instanceCI, VK_NULL_HANDLE, &m_Instance); Failed(vkResult))
         {
@@ -111,22 +265,25 @@ namespace UN
 
         volkLoadInstance(m_Instance);
 
-#if UN_DEBUG
-        VkDebugReportCallbackCreateInfoEXT debugCI{};
-        debugCI.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT;
-        debugCI.flags |= VK_DEBUG_REPORT_WARNING_BIT_EXT;
-        debugCI.flags |= VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT;
-        debugCI.flags |= VK_DEBUG_REPORT_ERROR_BIT_EXT;
-        debugCI.flags |= VK_DEBUG_REPORT_DEBUG_BIT_EXT;
-        debugCI.pfnCallback = &DebugReportCallback;
-
-        if (auto vkResult = vkCreateDebugReportCallbackEXT(m_Instance, &debugCI, VK_NULL_HANDLE, &m_Debug); Failed(vkResult))
+        if (isExtensionEnabled(VK_EXT_DEBUG_REPORT_EXTENSION_NAME))
         {
-            UN_Error(false, "Couldn't create Vulkan debug report callback, vkCreateDebugReportCallbackEXT returned {}", vkResult);
-            return VulkanConvert(vkResult);
+            VkDebugReportCallbackCreateInfoEXT debugCI{};
+            debugCI.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT;
+            debugCI.flags |= VK_DEBUG_REPORT_WARNING_BIT_EXT;
+            debugCI.flags |= VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT;
+            debugCI.flags |= VK_DEBUG_REPORT_ERROR_BIT_EXT;
+            debugCI.flags |= VK_DEBUG_REPORT_DEBUG_BIT_EXT;
+            debugCI.pfnCallback = &DebugReportCallback;
+
+            if (auto vkResult = vkCreateDebugReportCallbackEXT(m_Instance, &debugCI, VK_NULL_HANDLE, &m_Debug); Failed(vkResult))
+            {
+                UN_Error(false,
+                         "Couldn't create Vulkan debug report callback, vkCreateDebugReportCallbackEXT returned {}",
+                         vkResult);
+                return VulkanConvert(vkResult);
+            }
         }
 
-#endif
         UNLOG_Info("Vulkan instance created successfully");
 
         UInt32 adapterCount;
@@ -143,6 +300,9 @@ namespace UN
             auto& props = m_PhysicalDeviceProperties[i];
             vkGetPhysicalDeviceProperties(m_PhysicalDevices[i], &props);
 
+            // The device can't use a version newer than the one requested by the instance.
+            props.apiVersion = std::min(props.apiVersion, appInfo.apiVersion);
+
             UNLOG_Info("Found Vulkan compatible GPU: {}", props.deviceName);
 
             auto& adapter = m_Adapters[i];
@@ -167,6 +327,42 @@ namespace UN
                 adapter.Kind = AdapterKind::None;
                 break;
             }
+
+            GetSubgroupInfo(m_PhysicalDevices[i], adapter);
+            for (UInt32 j = 0; j < 3; ++j)
+            {
+                adapter.MaxWorkgroupCount[j] = props.limits.maxComputeWorkGroupCount[j];
+            }
+
+            VkPhysicalDeviceIDProperties idProps{};
+            idProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES;
+
+            VkPhysicalDeviceProperties2 props2{};
+            props2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+            props2.pNext = &idProps;
+            vkGetPhysicalDeviceProperties2(m_PhysicalDevices[i], &props2);
+
+            static_assert(AdapterInfo::UuidSize == VK_UUID_SIZE);
+            memcpy(adapter.DeviceUuid, idProps.deviceUUID, VK_UUID_SIZE);
+
+            VulkanDeviceFeatures features(props.apiVersion);
+            vkGetPhysicalDeviceFeatures2(m_PhysicalDevices[i], &features.Features);
+            adapter.SupportedFeatures = features.GetFlags();
+
+            if (props.apiVersion >= VK_API_VERSION_1_3)
+            {
+                adapter.TargetEnv = KernelTargetEnv::Vulkan1_3;
+            }
+            else if (props.apiVersion >= VK_API_VERSION_1_2)
+            {
+                adapter.TargetEnv = KernelTargetEnv::Vulkan1_2;
+            }
+            else
+            {
+                adapter.TargetEnv = KernelTargetEnv::Vulkan1_1;
+            }
+
+            adapter.ShaderModel = GetShaderModel(props.apiVersion, adapter.SupportedFeatures);
         }
 
         return ResultCode::Success;
@@ -198,6 +394,62 @@ namespace UN
         return m_Adapters;
     }
 
+    ResultCode VulkanDeviceFactory::GetAdapterCapabilities(UInt32 adapterId, AdapterCapabilities* pCapabilities)
+    {
+        if (adapterId >= m_Adapters.Length())
+        {
+            UN_Error(false, "Adapter ID {} is out of range, adapter count was {}", adapterId, m_Adapters.Length());
+            return ResultCode::InvalidArguments;
+        }
+
+        auto& adapter = m_Adapters[adapterId];
+        auto& limits  = m_PhysicalDeviceProperties[adapterId].limits;
+
+        *pCapabilities = {};
+        for (UInt32 i = 0; i < 3; ++i)
+        {
+            pCapabilities->MaxWorkgroupSize[i]  = limits.maxComputeWorkGroupSize[i];
+            pCapabilities->MaxWorkgroupCount[i] = limits.maxComputeWorkGroupCount[i];
+        }
+
+        pCapabilities->MaxWorkgroupInvocations = limits.maxComputeWorkGroupInvocations;
+        pCapabilities->MaxSharedMemorySize     = limits.maxComputeSharedMemorySize;
+        pCapabilities->MaxStorageBufferRange   = limits.maxStorageBufferRange;
+        pCapabilities->SubgroupSize            = adapter.SubgroupSize;
+        pCapabilities->MinSubgroupSize         = adapter.MinSubgroupSize;
+        pCapabilities->MaxSubgroupSize         = adapter.MaxSubgroupSize;
+        pCapabilities->SubgroupOperations      = adapter.SubgroupOperations;
+        pCapabilities->TimestampPeriod         = limits.timestampComputeAndGraphics ? limits.timestampPeriod : 0.0f;
+        pCapabilities->SupportedFeatures       = adapter.SupportedFeatures;
+
+        VkPhysicalDeviceMemoryProperties memoryProperties;
+        vkGetPhysicalDeviceMemoryProperties(m_PhysicalDevices[adapterId], &memoryProperties);
+
+        pCapabilities->MemoryHeapCount = std::min(memoryProperties.memoryHeapCount, AdapterCapabilities::MaxMemoryHeaps);
+        for (UInt32 i = 0; i < pCapabilities->MemoryHeapCount; ++i)
+        {
+            auto& heap = pCapabilities->MemoryHeaps[i];
+            heap.Size  = memoryProperties.memoryHeaps[i].size;
+            heap.Kind  = MemoryKindFlags::None;
+            if (memoryProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+            {
+                heap.Kind |= MemoryKindFlags::DeviceAccessible;
+            }
+        }
+
+        for (UInt32 i = 0; i < memoryProperties.memoryTypeCount; ++i)
+        {
+            auto& memoryType = memoryProperties.memoryTypes[i];
+            if (memoryType.heapIndex < pCapabilities->MemoryHeapCount
+                && (memoryType.propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+            {
+                pCapabilities->MemoryHeaps[memoryType.heapIndex].Kind |= MemoryKindFlags::HostAccessible;
+            }
+        }
+
+        return ResultCode::Success;
+    }
+
     BackendKind VulkanDeviceFactory::GetBackendKind() const
     {
         return BackendKind::Vulkan;
@@ -11,8 +11,10 @@ namespace UN
     //! \brief This class holds a Vulkan API instance.
     class VulkanDeviceFactory final : public Object<IDeviceFactory>
     {
-        VkInstance m_Instance;
-        VkDebugReportCallbackEXT m_Debug;
+        VkInstance m_Instance            = VK_NULL_HANDLE;
+        VkDebugReportCallbackEXT m_Debug = VK_NULL_HANDLE;
+        DeviceFactoryProfile m_Profile   = DeviceFactoryProfile::Production;
+        bool m_DebugUtilsEnabled         = false;
 
         HeapArray<AdapterInfo> m_Adapters;
         HeapArray<VkPhysicalDevice> m_PhysicalDevices;
@@ -21,11 +23,24 @@ namespace UN
     public:
         ~VulkanDeviceFactory() override;
 
-        //! \brief Create a VkInstance, VkDebugReportCallbackEXT (if needed) and get physical device properties.
+        //! \brief Create a VkInstance, VkDebugReportCallbackEXT (if needed by the profile) and get physical device properties.
         ResultCode Init(const DeviceFactoryDesc& desc) override;
         void Reset() override;
 
         ArraySlice<const AdapterInfo> EnumerateAdapters() override;
+        ResultCode GetAdapterCapabilities(UInt32 adapterId, AdapterCapabilities* pCapabilities) override;
+
+        //! \brief Get the debugging and validation profile the factory was initialized with.
+        [[nodiscard]] inline DeviceFactoryProfile GetProfile() const
+        {
+            return m_Profile;
+        }
+
+        //! \brief Check if VK_EXT_debug_utils is enabled, so that debug names can be assigned to Vulkan objects.
+        [[nodiscard]] inline bool IsDebugUtilsEnabled() const
+        {
+            return m_DebugUtilsEnabled;
+        }
 
         [[nodiscard]] inline ArraySlice<const VkPhysicalDevice> GetVulkanAdapters() const
         {
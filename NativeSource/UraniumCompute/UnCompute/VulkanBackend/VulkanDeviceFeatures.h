@@ -0,0 +1,82 @@
+#pragma once
+#include <UnCompute/Backend/BaseTypes.h>
+#include <UnCompute/VulkanBackend/VulkanInclude.h>
+
+namespace UN
+{
+    //! \brief A chain of Vulkan feature structures that correspond to DeviceFeatureFlags.
+    //!
+    //! Used both to query the features supported by an adapter and to enable them on device creation.
+    //! The structures introduced in Vulkan 1.2 are only chained if the adapter supports it.
+    struct VulkanDeviceFeatures
+    {
+        VkPhysicalDeviceFeatures2 Features                    = {};
+        VkPhysicalDevice16BitStorageFeatures Storage16Bit     = {};
+        VkPhysicalDevice8BitStorageFeatures Storage8Bit       = {};
+        VkPhysicalDeviceShaderFloat16Int8Features Float16Int8 = {};
+        VkPhysicalDeviceShaderAtomicInt64Features AtomicInt64 = {};
+
+        inline explicit VulkanDeviceFeatures(UInt32 apiVersion)
+        {
+            Features.sType     = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+            Storage16Bit.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES;
+            Storage8Bit.sType  = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES;
+            Float16Int8.sType  = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES;
+            AtomicInt64.sType  = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES;
+
+            Features.pNext = &Storage16Bit;
+            if (apiVersion >= VK_API_VERSION_1_2)
+            {
+                Storage16Bit.pNext = &Storage8Bit;
+                Storage8Bit.pNext  = &Float16Int8;
+                Float16Int8.pNext  = &AtomicInt64;
+            }
+        }
+
+        // The structures point to each other, so they can't be copied.
+        VulkanDeviceFeatures(const VulkanDeviceFeatures&)            = delete;
+        VulkanDeviceFeatures& operator=(const VulkanDeviceFeatures&) = delete;
+
+        //! \brief Insert a structure into the chain, right after VkPhysicalDeviceFeatures2.
+        //!
+        //! \param pFeatures - A Vulkan structure that has sType and pNext fields.
+        template<class T>
+        inline void Append(T* pFeatures)
+        {
+            pFeatures->pNext = Features.pNext;
+            Features.pNext   = pFeatures;
+        }
+
+        [[nodiscard]] inline DeviceFeatureFlags GetFlags() const
+        {
+            auto result = DeviceFeatureFlags::None;
+            // clang-format off
+            if (Float16Int8.shaderFloat16)             result |= DeviceFeatureFlags::Float16;
+            if (Features.features.shaderFloat64)       result |= DeviceFeatureFlags::Float64;
+            if (Float16Int8.shaderInt8)                result |= DeviceFeatureFlags::Int8;
+            if (Features.features.shaderInt16)         result |= DeviceFeatureFlags::Int16;
+            if (Features.features.shaderInt64)         result |= DeviceFeatureFlags::Int64;
+            if (Storage16Bit.storageBuffer16BitAccess) result |= DeviceFeatureFlags::Storage16Bit;
+            if (Storage8Bit.storageBuffer8BitAccess)   result |= DeviceFeatureFlags::Storage8Bit;
+            if (AtomicInt64.shaderBufferInt64Atomics)  result |= DeviceFeatureFlags::Int64Atomics;
+            // clang-format on
+            return result;
+        }
+
+        inline void SetFlags(DeviceFeatureFlags flags)
+        {
+            auto toVkBool = [flags](DeviceFeatureFlags flag) {
+                return AllFlagsActive(flags, flag) ? VK_TRUE : VK_FALSE;
+            };
+
+            Float16Int8.shaderFloat16             = toVkBool(DeviceFeatureFlags::Float16);
+            Features.features.shaderFloat64       = toVkBool(DeviceFeatureFlags::Float64);
+            Float16Int8.shaderInt8                = toVkBool(DeviceFeatureFlags::Int8);
+            Features.features.shaderInt16         = toVkBool(DeviceFeatureFlags::Int16);
+            Features.features.shaderInt64         = toVkBool(DeviceFeatureFlags::Int64);
+            Storage16Bit.storageBuffer16BitAccess = toVkBool(DeviceFeatureFlags::Storage16Bit);
+            Storage8Bit.storageBuffer8BitAccess   = toVkBool(DeviceFeatureFlags::Storage8Bit);
+            AtomicInt64.shaderBufferInt64Atomics  = toVkBool(DeviceFeatureFlags::Int64Atomics);
+        }
+    };
+} // namespace UN
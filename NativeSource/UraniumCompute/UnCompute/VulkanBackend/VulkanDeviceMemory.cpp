@@ -1,6 +1,7 @@
 #include <UnCompute/VulkanBackend/VulkanBuffer.h>
 #include <UnCompute/VulkanBackend/VulkanComputeDevice.h>
 #include <UnCompute/VulkanBackend/VulkanDeviceMemory.h>
+#include <UnCompute/VulkanBackend/VulkanImage.h>
 
 namespace UN
 {
@@ -18,6 +19,16 @@ namespace UN
         }
     }
 
+    inline const VkMemoryRequirements& GetMemoryRequirements(const IDeviceObject* pObject)
+    {
+        if (auto* pImage = dynamic_cast<const VulkanImage*>(pObject))
+        {
+            return pImage->GetMemoryRequirements();
+        }
+
+        return un_verify_cast<const VulkanBuffer*>(pObject)->GetMemoryRequirements();
+    }
+
     VulkanDeviceMemory::VulkanDeviceMemory(IComputeDevice* pDevice)
         : DeviceMemoryBase(pDevice)
     {
@@ -43,14 +54,16 @@ namespace UN
         m_MapByteOffset = byteOffset;
         m_MapByteSize   = byteSize;
 
-        auto vkDevice = m_pDevice.As<VulkanComputeDevice>()->GetNativeDevice();
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
 
-        auto vkResult = vkMapMemory(vkDevice, m_NativeMemory, byteOffset, byteSize, VK_FLAGS_NONE, ppData);
+        auto vkResult = deviceTable.vkMapMemory(vkDevice, m_NativeMemory, byteOffset, byteSize, VK_FLAGS_NONE, ppData);
         m_Mapped      = Succeeded(vkResult);
         UN_Error(m_Mapped, "Couldn't map Vulkan memory, vkMapMemory returned {}", vkResult);
 
         auto range = GetMappedMemoryRange();
-        vkInvalidateMappedMemoryRanges(vkDevice, 1, &range);
+        deviceTable.vkInvalidateMappedMemoryRanges(vkDevice, 1, &range);
         return VulkanConvert(vkResult);
     }
 
@@ -61,17 +74,19 @@ namespace UN
             return;
         }
 
-        auto vkDevice = m_pDevice.As<VulkanComputeDevice>()->GetNativeDevice();
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
         auto range    = GetMappedMemoryRange();
-        vkFlushMappedMemoryRanges(vkDevice, 1, &range);
+        deviceTable.vkFlushMappedMemoryRanges(vkDevice, 1, &range);
 
-        vkUnmapMemory(vkDevice, m_NativeMemory);
+        deviceTable.vkUnmapMemory(vkDevice, m_NativeMemory);
         m_Mapped = false;
     }
 
     bool VulkanDeviceMemory::IsCompatible(IDeviceObject* pObject, UInt64 sizeLimit)
     {
-        auto requirements = un_verify_cast<VulkanBuffer*>(pObject)->GetMemoryRequirements();
+        auto& requirements = GetMemoryRequirements(pObject);
         return requirements.size <= sizeLimit && (requirements.memoryTypeBits & (1u << m_MemoryTypeIndex)) != 0;
     }
 
@@ -84,7 +99,9 @@ namespace UN
     {
         if (m_NativeMemory != VK_NULL_HANDLE)
         {
-            vkFreeMemory(m_pDevice.As<VulkanComputeDevice>()->GetNativeDevice(), m_NativeMemory, VK_NULL_HANDLE);
+            auto* pDevice = m_pDevice.As<VulkanComputeDevice>();
+            pDevice->GetDeviceTable().vkFreeMemory(pDevice->GetNativeDevice(), m_NativeMemory, VK_NULL_HANDLE);
+            pDevice->OnMemoryFreed(m_MemoryTypeIndex, m_Desc.Size);
             m_NativeMemory = VK_NULL_HANDLE;
         }
     }
@@ -107,10 +124,10 @@ namespace UN
         UInt64 alignment  = 1;
         for (const auto* object : desc.Objects)
         {
-            auto* buffer = un_verify_cast<const VulkanBuffer*>(object);
-            typeBits &= buffer->GetMemoryRequirements().memoryTypeBits;
-            objectSize += buffer->GetMemoryRequirements().size;
-            alignment = std::max(alignment, buffer->GetMemoryRequirements().alignment);
+            auto& requirements = GetMemoryRequirements(object);
+            typeBits &= requirements.memoryTypeBits;
+            objectSize += requirements.size;
+            alignment = std::max(alignment, requirements.alignment);
         }
 
         if (typeBits == 0)
@@ -129,12 +146,16 @@ namespace UN
         UN_VerifyResult(vkDevice->FindMemoryType(typeBits, properties, m_MemoryTypeIndex), "Couldn't find device memory type");
         info.memoryTypeIndex = m_MemoryTypeIndex;
 
-        if (auto vkResult = vkAllocateMemory(vkDevice->GetNativeDevice(), &info, nullptr, &m_NativeMemory); Failed(vkResult))
+        auto& deviceTable = vkDevice->GetDeviceTable();
+        if (auto vkResult = deviceTable.vkAllocateMemory(vkDevice->GetNativeDevice(), &info, nullptr, &m_NativeMemory);
+            Failed(vkResult))
         {
             UN_Error(false, "Couldn't allocate Vulkan device memory, vkAllocateMemory returned {}", vkResult);
             return VulkanConvert(vkResult);
         }
 
+        vkDevice->OnMemoryAllocated(m_MemoryTypeIndex, m_Desc.Size);
+        vkDevice->SetDebugName(VK_OBJECT_TYPE_DEVICE_MEMORY, reinterpret_cast<UInt64>(m_NativeMemory), m_Name);
         return ResultCode::Success;
     }
 
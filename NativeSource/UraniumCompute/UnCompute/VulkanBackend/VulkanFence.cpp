@@ -1,6 +1,11 @@
 #include <UnCompute/VulkanBackend/VulkanComputeDevice.h>
 #include <UnCompute/VulkanBackend/VulkanFence.h>
 
+#if UN_LINUX
+#    include <sys/eventfd.h>
+#    include <unistd.h>
+#endif
+
 namespace UN
 {
     VulkanFence::VulkanFence(IComputeDevice* pDevice)
@@ -20,52 +25,157 @@ namespace UN
             return;
         }
 
-        auto vkDevice = m_pDevice.As<VulkanComputeDevice>()->GetNativeDevice();
-        vkDestroyFence(vkDevice, m_NativeFence, nullptr);
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+        deviceTable.vkDestroyFence(vkDevice, m_NativeFence, nullptr);
         m_NativeFence = VK_NULL_HANDLE;
     }
 
     ResultCode VulkanFence::SignalOnCpu()
     {
-        auto queue = m_pDevice.As<VulkanComputeDevice>()->GetDeviceQueue(HardwareQueueKindFlags::Compute);
+        auto* pDevice = m_pDevice.As<VulkanComputeDevice>();
+        auto queue    = pDevice->GetDeviceQueue(HardwareQueueKindFlags::Compute);
 
         VkSubmitInfo submitInfo{};
         submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 
-        auto vkResult = vkQueueSubmit(queue, 1, &submitInfo, m_NativeFence);
+        auto vkResult = pDevice->GetDeviceTable().vkQueueSubmit(queue, 1, &submitInfo, m_NativeFence);
         UN_VerifyResult(vkResult, "Couldn't submit Vulkan queue to signal a fence");
         return VulkanConvert(vkResult);
     }
 
     ResultCode VulkanFence::WaitOnCpu(std::chrono::nanoseconds timeout)
     {
-        auto vkDevice = m_pDevice.As<VulkanComputeDevice>()->GetNativeDevice();
-        auto vkResult = vkWaitForFences(vkDevice, 1, &m_NativeFence, false, timeout.count());
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+        auto vkResult     = deviceTable.vkWaitForFences(vkDevice, 1, &m_NativeFence, false, timeout.count());
         return VulkanConvert(vkResult);
     }
 
     void VulkanFence::ResetState()
     {
-        auto vkDevice = m_pDevice.As<VulkanComputeDevice>()->GetNativeDevice();
-        vkResetFences(vkDevice, 1, &m_NativeFence);
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+        deviceTable.vkResetFences(vkDevice, 1, &m_NativeFence);
     }
 
     FenceState VulkanFence::GetState()
     {
-        auto vkDevice = m_pDevice.As<VulkanComputeDevice>()->GetNativeDevice();
-        auto status   = vkGetFenceStatus(vkDevice, m_NativeFence);
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+        auto status       = deviceTable.vkGetFenceStatus(vkDevice, m_NativeFence);
         return status == VK_SUCCESS ? FenceState::Signaled : FenceState::Reset;
     }
 
+    ResultCode VulkanFence::ExportCompletionFd(Int32* pFileDescriptor)
+    {
+        auto* pDevice = m_pDevice.As<VulkanComputeDevice>();
+        if (!pDevice->AreSyncFdFencesSupported())
+        {
+            UN_Error(false, "Couldn't export a Vulkan fence, sync file descriptors are not supported by the device");
+            return ResultCode::NotImplemented;
+        }
+
+#if UN_LINUX
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+
+        VkFenceGetFdInfoKHR getFdInfo{};
+        getFdInfo.sType      = VK_STRUCTURE_TYPE_FENCE_GET_FD_INFO_KHR;
+        getFdInfo.fence      = m_NativeFence;
+        getFdInfo.handleType = VK_EXTERNAL_FENCE_HANDLE_TYPE_SYNC_FD_BIT;
+
+        int syncFd    = -1;
+        auto vkResult = deviceTable.vkGetFenceFdKHR(vkDevice, &getFdInfo, &syncFd);
+        UN_VerifyResult(vkResult, "Couldn't export a sync file descriptor from a Vulkan fence");
+        if (Failed(vkResult))
+        {
+            return VulkanConvert(vkResult);
+        }
+
+        // Exporting a sync file resets the fence, so a copy of the file is imported back as a temporary payload to keep
+        // GetState() and WaitOnCpu() working. The permanent payload is restored by the next vkResetFences().
+        // A sync file of -1 means that the fence has already been signaled, importing it signals the fence again.
+        int importedFd = syncFd < 0 ? -1 : dup(syncFd);
+        if (syncFd >= 0 && importedFd < 0)
+        {
+            close(syncFd);
+            UN_Error(false, "Couldn't duplicate a sync file descriptor");
+            return ResultCode::Fail;
+        }
+
+        VkImportFenceFdInfoKHR importFdInfo{};
+        importFdInfo.sType      = VK_STRUCTURE_TYPE_IMPORT_FENCE_FD_INFO_KHR;
+        importFdInfo.fence      = m_NativeFence;
+        importFdInfo.flags      = VK_FENCE_IMPORT_TEMPORARY_BIT;
+        importFdInfo.handleType = VK_EXTERNAL_FENCE_HANDLE_TYPE_SYNC_FD_BIT;
+        importFdInfo.fd         = importedFd;
+
+        // On success the Vulkan implementation takes ownership of the imported descriptor.
+        vkResult = deviceTable.vkImportFenceFdKHR(vkDevice, &importFdInfo);
+        UN_VerifyResult(vkResult, "Couldn't import a sync file descriptor back to a Vulkan fence");
+        if (Failed(vkResult))
+        {
+            if (importedFd >= 0)
+            {
+                close(importedFd);
+            }
+            if (syncFd >= 0)
+            {
+                close(syncFd);
+            }
+
+            return VulkanConvert(vkResult);
+        }
+
+        // A signaled sync file can't be polled, return an eventfd that is readable right away instead.
+        if (syncFd < 0)
+        {
+            syncFd = eventfd(1, EFD_CLOEXEC);
+            UN_Error(syncFd >= 0, "Couldn't create an eventfd for a signaled Vulkan fence");
+            if (syncFd < 0)
+            {
+                return ResultCode::Fail;
+            }
+        }
+
+        *pFileDescriptor = syncFd;
+        return ResultCode::Success;
+#else
+        (void)pFileDescriptor;
+        return ResultCode::NotImplemented;
+#endif
+    }
+
     ResultCode VulkanFence::InitInternal(const DescriptorType& desc)
     {
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+
         VkFenceCreateInfo fenceCI{};
         fenceCI.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
         fenceCI.flags = desc.InitialState == FenceState::Reset ? 0 : VK_FENCE_CREATE_SIGNALED_BIT;
 
-        auto vkDevice = m_pDevice.As<VulkanComputeDevice>()->GetNativeDevice();
-        auto result   = vkCreateFence(vkDevice, &fenceCI, VK_NULL_HANDLE, &m_NativeFence);
+        VkExportFenceCreateInfo exportFenceCI{};
+        exportFenceCI.sType       = VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO;
+        exportFenceCI.handleTypes = VK_EXTERNAL_FENCE_HANDLE_TYPE_SYNC_FD_BIT;
+        if (pDevice->AreSyncFdFencesSupported())
+        {
+            fenceCI.pNext = &exportFenceCI;
+        }
+
+        auto result = deviceTable.vkCreateFence(vkDevice, &fenceCI, VK_NULL_HANDLE, &m_NativeFence);
         UN_Error(Succeeded(result), "Couldn't initialize Vulkan fence, vkCreateFence returned {}", result);
+        if (Succeeded(result))
+        {
+            pDevice->SetDebugName(VK_OBJECT_TYPE_FENCE, reinterpret_cast<UInt64>(m_NativeFence), m_Name);
+        }
+
         return VulkanConvert(result);
     }
 } // namespace UN
@@ -27,6 +27,7 @@ namespace UN
 
         void ResetState() override;
         FenceState GetState() override;
+        ResultCode ExportCompletionFd(Int32* pFileDescriptor) override;
 
         [[nodiscard]] inline VkFence GetNativeFence() const
         {
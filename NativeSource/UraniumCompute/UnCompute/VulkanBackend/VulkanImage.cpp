@@ -0,0 +1,165 @@
+#include <UnCompute/VulkanBackend/VulkanComputeDevice.h>
+#include <UnCompute/VulkanBackend/VulkanDeviceMemory.h>
+#include <UnCompute/VulkanBackend/VulkanImage.h>
+
+namespace UN
+{
+    inline VkImageType VulkanConvert(ImageDimension dimension)
+    {
+        switch (dimension)
+        {
+        case ImageDimension::Image1D:
+            return VK_IMAGE_TYPE_1D;
+        case ImageDimension::Image2D:
+            return VK_IMAGE_TYPE_2D;
+        case ImageDimension::Image3D:
+            return VK_IMAGE_TYPE_3D;
+        default:
+            UN_Error(false, "Unknown ImageDimension::<{}>", static_cast<Int32>(dimension));
+            return VK_IMAGE_TYPE_MAX_ENUM;
+        }
+    }
+
+    inline VkImageViewType GetImageViewType(ImageDimension dimension)
+    {
+        switch (dimension)
+        {
+        case ImageDimension::Image1D:
+            return VK_IMAGE_VIEW_TYPE_1D;
+        case ImageDimension::Image2D:
+            return VK_IMAGE_VIEW_TYPE_2D;
+        case ImageDimension::Image3D:
+            return VK_IMAGE_VIEW_TYPE_3D;
+        default:
+            UN_Error(false, "Unknown ImageDimension::<{}>", static_cast<Int32>(dimension));
+            return VK_IMAGE_VIEW_TYPE_MAX_ENUM;
+        }
+    }
+
+    VulkanImage::VulkanImage(IComputeDevice* pDevice)
+        : ImageBase(pDevice)
+    {
+    }
+
+    ResultCode VulkanImage::BindMemory(const DeviceMemorySlice& deviceMemory)
+    {
+        if (!deviceMemory.IsCompatible(this))
+        {
+            UN_Error(false, "Incompatible memory");
+            return ResultCode::Fail;
+        }
+
+        m_Memory      = deviceMemory;
+        m_MemoryOwner = un_verify_cast<VulkanDeviceMemory*>(m_Memory.GetDeviceMemory());
+        auto vkMemory = m_MemoryOwner->GetNativeMemory();
+
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+        auto vkResult     = deviceTable.vkBindImageMemory(vkDevice, m_NativeImage, vkMemory, deviceMemory.GetByteOffset());
+        if (Failed(vkResult))
+        {
+            UN_Error(false, "Couldn't bind Vulkan memory to image, vkBindImageMemory returned {}", vkResult);
+            return VulkanConvert(vkResult);
+        }
+
+        VkImageViewCreateInfo viewCI{};
+        viewCI.sType                           = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewCI.image                           = m_NativeImage;
+        viewCI.viewType                        = GetImageViewType(m_Desc.Dimension);
+        viewCI.format                          = VulkanConvert(m_Desc.Format);
+        viewCI.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        viewCI.subresourceRange.baseMipLevel   = 0;
+        viewCI.subresourceRange.levelCount     = 1;
+        viewCI.subresourceRange.baseArrayLayer = 0;
+        viewCI.subresourceRange.layerCount     = 1;
+
+        if (m_NativeImageView != VK_NULL_HANDLE)
+        {
+            deviceTable.vkDestroyImageView(vkDevice, m_NativeImageView, nullptr);
+            m_NativeImageView = VK_NULL_HANDLE;
+        }
+
+        if (auto vkResult = deviceTable.vkCreateImageView(vkDevice, &viewCI, nullptr, &m_NativeImageView); Failed(vkResult))
+        {
+            UN_Error(false, "Couldn't create Vulkan image view, vkCreateImageView returned {}", vkResult);
+            return VulkanConvert(vkResult);
+        }
+
+        return pDevice->InitializeImageLayout(m_NativeImage);
+    }
+
+    void VulkanImage::Reset()
+    {
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+        if (m_NativeImageView != VK_NULL_HANDLE)
+        {
+            deviceTable.vkDestroyImageView(vkDevice, m_NativeImageView, nullptr);
+            m_NativeImageView = VK_NULL_HANDLE;
+        }
+
+        if (m_NativeImage != VK_NULL_HANDLE)
+        {
+            deviceTable.vkDestroyImage(vkDevice, m_NativeImage, nullptr);
+            m_NativeImage = VK_NULL_HANDLE;
+        }
+    }
+
+    ResultCode VulkanImage::InitInternal(const ImageDesc& desc)
+    {
+        if (desc.Format == Format::None)
+        {
+            UN_Error(false, "Image format must be specified");
+            return ResultCode::InvalidArguments;
+        }
+
+        VkImageCreateInfo imageCI{};
+        imageCI.sType         = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageCI.imageType     = VulkanConvert(desc.Dimension);
+        imageCI.format        = VulkanConvert(desc.Format);
+        imageCI.extent.width  = desc.Width;
+        imageCI.extent.height = desc.Height;
+        imageCI.extent.depth  = desc.Depth;
+        imageCI.mipLevels     = 1;
+        imageCI.arrayLayers   = 1;
+        imageCI.samples       = VK_SAMPLE_COUNT_1_BIT;
+        imageCI.tiling        = VK_IMAGE_TILING_OPTIMAL;
+        imageCI.sharingMode   = VK_SHARING_MODE_EXCLUSIVE;
+        imageCI.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        imageCI.usage         = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+
+        if (AllFlagsActive(desc.Usage, ImageUsageFlags::Sampled))
+        {
+            imageCI.usage |= VK_IMAGE_USAGE_SAMPLED_BIT;
+        }
+        if (AllFlagsActive(desc.Usage, ImageUsageFlags::Storage))
+        {
+            imageCI.usage |= VK_IMAGE_USAGE_STORAGE_BIT;
+        }
+
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+        if (auto vkResult = deviceTable.vkCreateImage(vkDevice, &imageCI, nullptr, &m_NativeImage); Failed(vkResult))
+        {
+            UN_Error(false, "Couldn't create Vulkan image, vkCreateImage returned {}", vkResult);
+            return VulkanConvert(vkResult);
+        }
+
+        deviceTable.vkGetImageMemoryRequirements(vkDevice, m_NativeImage, &m_MemoryRequirements);
+        pDevice->SetDebugName(VK_OBJECT_TYPE_IMAGE, reinterpret_cast<UInt64>(m_NativeImage), m_Name);
+        return ResultCode::Success;
+    }
+
+    VulkanImage::~VulkanImage()
+    {
+        Reset();
+    }
+
+    ResultCode VulkanImage::BindMemory(IDeviceMemory* pDeviceMemory)
+    {
+        return BindMemory(DeviceMemorySlice(pDeviceMemory));
+    }
+} // namespace UN
@@ -0,0 +1,56 @@
+#pragma once
+#include <UnCompute/Backend/IDeviceMemory.h>
+#include <UnCompute/Backend/ImageBase.h>
+#include <UnCompute/Memory/Memory.h>
+#include <UnCompute/VulkanBackend/VulkanInclude.h>
+
+namespace UN
+{
+    class VulkanDeviceMemory;
+
+    //! \brief Vulkan image, always used in VK_IMAGE_LAYOUT_GENERAL.
+    //!
+    //! The image is transitioned to VK_IMAGE_LAYOUT_GENERAL once when memory is bound to it, so command lists never
+    //! record layout transitions.
+    class VulkanImage final : public ImageBase
+    {
+        VkImage m_NativeImage                     = VK_NULL_HANDLE;
+        VkImageView m_NativeImageView             = VK_NULL_HANDLE;
+        VkMemoryRequirements m_MemoryRequirements = {};
+        Ptr<VulkanDeviceMemory> m_MemoryOwner     = {}; // !!! must be here to not free the memory before ~DeviceMemorySlice()
+        DeviceMemorySlice m_Memory                = {};
+
+    protected:
+        ResultCode InitInternal(const ImageDesc& desc) override;
+
+    public:
+        explicit VulkanImage(IComputeDevice* pDevice);
+        ~VulkanImage() override;
+
+        ResultCode BindMemory(const DeviceMemorySlice& deviceMemory) override;
+        ResultCode BindMemory(IDeviceMemory* pDeviceMemory) override;
+        void Reset() override;
+
+        [[nodiscard]] inline VkImage GetNativeImage() const
+        {
+            return m_NativeImage;
+        }
+
+        [[nodiscard]] inline VkImageView GetNativeImageView() const
+        {
+            return m_NativeImageView;
+        }
+
+        [[nodiscard]] inline const VkMemoryRequirements& GetMemoryRequirements() const
+        {
+            return m_MemoryRequirements;
+        }
+
+        inline static ResultCode Create(IComputeDevice* pDevice, IImage** ppImage)
+        {
+            *ppImage = AllocateObject<VulkanImage>(pDevice);
+            (*ppImage)->AddRef();
+            return ResultCode::Success;
+        }
+    };
+} // namespace UN
@@ -1,4 +1,5 @@
 #pragma once
+#include <UnCompute/Backend/Format.h>
 #include <UnCompute/Base/Logger.h>
 #include <array>
 #include <volk.h>
@@ -10,9 +11,10 @@ namespace UN
         VK_FLAGS_NONE = 0
     };
 
-    constexpr auto RequiredInstanceExtensions = std::array{ VK_EXT_DEBUG_REPORT_EXTENSION_NAME,
-                                                            VK_EXT_DEBUG_UTILS_EXTENSION_NAME,
-                                                            VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME };
+    constexpr auto RequiredInstanceExtensions = std::array{ VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME };
+
+    //! \brief Instance extensions enabled by debug device factory profiles if available.
+    constexpr auto DebugInstanceExtensions = std::array{ VK_EXT_DEBUG_REPORT_EXTENSION_NAME, VK_EXT_DEBUG_UTILS_EXTENSION_NAME };
 
     constexpr auto DescriptorTypeMaxValue = VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT + 1;
 
@@ -80,6 +82,55 @@ namespace UN
             return ResultCode::Fail;
         }
     }
+
+    inline VkFormat VulkanConvert(Format format)
+    {
+        switch (format)
+        {
+            // clang-format off
+        case Format::None:                return VK_FORMAT_UNDEFINED;
+        case Format::R8_UNorm:            return VK_FORMAT_R8_UNORM;
+        case Format::R8_SNorm:            return VK_FORMAT_R8_SNORM;
+        case Format::R8_UInt:             return VK_FORMAT_R8_UINT;
+        case Format::R8_SInt:             return VK_FORMAT_R8_SINT;
+        case Format::R8G8_UNorm:          return VK_FORMAT_R8G8_UNORM;
+        case Format::R8G8_SNorm:          return VK_FORMAT_R8G8_SNORM;
+        case Format::R8G8_UInt:           return VK_FORMAT_R8G8_UINT;
+        case Format::R8G8_SInt:           return VK_FORMAT_R8G8_SINT;
+        case Format::R8G8B8A8_UNorm:      return VK_FORMAT_R8G8B8A8_UNORM;
+        case Format::R8G8B8A8_SNorm:      return VK_FORMAT_R8G8B8A8_SNORM;
+        case Format::R8G8B8A8_UInt:       return VK_FORMAT_R8G8B8A8_UINT;
+        case Format::R8G8B8A8_SInt:       return VK_FORMAT_R8G8B8A8_SINT;
+        case Format::R16_UNorm:           return VK_FORMAT_R16_UNORM;
+        case Format::R16_SNorm:           return VK_FORMAT_R16_SNORM;
+        case Format::R16_UInt:            return VK_FORMAT_R16_UINT;
+        case Format::R16_SInt:            return VK_FORMAT_R16_SINT;
+        case Format::R16_SFloat:          return VK_FORMAT_R16_SFLOAT;
+        case Format::R16G16_UNorm:        return VK_FORMAT_R16G16_UNORM;
+        case Format::R16G16_SNorm:        return VK_FORMAT_R16G16_SNORM;
+        case Format::R16G16_UInt:         return VK_FORMAT_R16G16_UINT;
+        case Format::R16G16_SInt:         return VK_FORMAT_R16G16_SINT;
+        case Format::R16G16_SFloat:       return VK_FORMAT_R16G16_SFLOAT;
+        case Format::R16G16B16A16_UNorm:  return VK_FORMAT_R16G16B16A16_UNORM;
+        case Format::R16G16B16A16_SNorm:  return VK_FORMAT_R16G16B16A16_SNORM;
+        case Format::R16G16B16A16_UInt:   return VK_FORMAT_R16G16B16A16_UINT;
+        case Format::R16G16B16A16_SInt:   return VK_FORMAT_R16G16B16A16_SINT;
+        case Format::R16G16B16A16_SFloat: return VK_FORMAT_R16G16B16A16_SFLOAT;
+        case Format::R32_UInt:            return VK_FORMAT_R32_UINT;
+        case Format::R32_SInt:            return VK_FORMAT_R32_SINT;
+        case Format::R32_SFloat:          return VK_FORMAT_R32_SFLOAT;
+        case Format::R32G32_UInt:         return VK_FORMAT_R32G32_UINT;
+        case Format::R32G32_SInt:         return VK_FORMAT_R32G32_SINT;
+        case Format::R32G32_SFloat:       return VK_FORMAT_R32G32_SFLOAT;
+        case Format::R32G32B32A32_UInt:   return VK_FORMAT_R32G32B32A32_UINT;
+        case Format::R32G32B32A32_SInt:   return VK_FORMAT_R32G32B32A32_SINT;
+        case Format::R32G32B32A32_SFloat: return VK_FORMAT_R32G32B32A32_SFLOAT;
+            // clang-format on
+        default:
+            UN_Assert(false, "Format was unknown");
+            return VK_FORMAT_UNDEFINED;
+        }
+    }
 } // namespace UN
 
 template<>
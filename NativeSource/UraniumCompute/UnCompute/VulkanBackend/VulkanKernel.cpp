@@ -1,3 +1,4 @@
+#include <UnCompute/Compilation/KernelReflection.h>
 #include <UnCompute/VulkanBackend/VulkanComputeDevice.h>
 #include <UnCompute/VulkanBackend/VulkanKernel.h>
 #include <UnCompute/VulkanBackend/VulkanResourceBinding.h>
@@ -11,10 +12,12 @@ namespace UN
             return;
         }
 
-        auto vkDevice = m_pDevice.As<VulkanComputeDevice>()->GetNativeDevice();
-        vkDestroyPipeline(vkDevice, m_Pipeline, nullptr);
-        vkDestroyPipelineCache(vkDevice, m_PipelineCache, nullptr);
-        vkDestroyShaderModule(vkDevice, m_ShaderModule, nullptr);
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+        deviceTable.vkDestroyPipeline(vkDevice, m_Pipeline, nullptr);
+        deviceTable.vkDestroyPipelineCache(vkDevice, m_PipelineCache, nullptr);
+        deviceTable.vkDestroyShaderModule(vkDevice, m_ShaderModule, nullptr);
         m_Pipeline      = VK_NULL_HANDLE;
         m_PipelineCache = VK_NULL_HANDLE;
         m_ShaderModule  = VK_NULL_HANDLE;
@@ -24,12 +27,37 @@ namespace UN
     {
         m_pResourceBinding = un_verify_cast<VulkanResourceBinding*>(desc.pResourceBinding);
 
-        auto device   = m_pDevice.As<VulkanComputeDevice>();
-        auto vkDevice = device->GetNativeDevice();
+        auto device       = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = device->GetNativeDevice();
+        auto& deviceTable = device->GetDeviceTable();
+
+        if (auto subgroupSize = desc.RequiredSubgroupSize; subgroupSize > 0)
+        {
+            auto& adapter = device->GetAdapterInfo();
+            if (subgroupSize < adapter.MinSubgroupSize || subgroupSize > adapter.MaxSubgroupSize
+                || (subgroupSize & (subgroupSize - 1)) != 0)
+            {
+                UN_Error(false,
+                         "Required subgroup size {} is not supported, must be a power of two in range [{}, {}]",
+                         subgroupSize,
+                         adapter.MinSubgroupSize,
+                         adapter.MaxSubgroupSize);
+                return ResultCode::InvalidArguments;
+            }
+        }
+
+        KernelReflection reflection;
+        if (auto result = KernelReflection::FromSpirV(desc.Bytecode, "main", &reflection); Failed(result))
+        {
+            UN_Error(false, "Couldn't reflect the kernel bytecode, result code was {}", result);
+            return result;
+        }
+
+        m_WorkgroupSize = reflection.LocalSize;
 
         VkPipelineCacheCreateInfo cacheCI{};
         cacheCI.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
-        if (auto result = vkCreatePipelineCache(vkDevice, &cacheCI, nullptr, &m_PipelineCache); Failed(result))
+        if (auto result = deviceTable.vkCreatePipelineCache(vkDevice, &cacheCI, nullptr, &m_PipelineCache); Failed(result))
         {
             UN_Error(false, "Couldn't create Vulkan pipeline cache, vkCreatePipelineCache returned {}", result);
             return VulkanConvert(result);
@@ -51,7 +79,7 @@ namespace UN
         moduleCI.codeSize = m_Desc.Bytecode.Length();
         moduleCI.pCode    = m_ShaderBytecode.Data();
 
-        if (auto result = vkCreateShaderModule(vkDevice, &moduleCI, nullptr, &m_ShaderModule); Failed(result))
+        if (auto result = deviceTable.vkCreateShaderModule(vkDevice, &moduleCI, nullptr, &m_ShaderModule); Failed(result))
         {
             UN_Error(false, "Couldn't create Vulkan shader module, vkCreateShaderModule returned {}", result);
             return VulkanConvert(result);
@@ -60,15 +88,25 @@ namespace UN
         shaderStage.module = m_ShaderModule;
         shaderStage.pName  = "main";
 
+        VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT subgroupSizeCI{};
+        subgroupSizeCI.sType                = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO_EXT;
+        subgroupSizeCI.requiredSubgroupSize = m_Desc.RequiredSubgroupSize;
+        if (m_Desc.RequiredSubgroupSize > 0)
+        {
+            shaderStage.pNext = &subgroupSizeCI;
+        }
+
         pipelineCI.stage = shaderStage;
 
-        if (auto result = vkCreateComputePipelines(vkDevice, m_PipelineCache, 1, &pipelineCI, nullptr, &m_Pipeline);
+        if (auto result = deviceTable.vkCreateComputePipelines(vkDevice, m_PipelineCache, 1, &pipelineCI, nullptr, &m_Pipeline);
             Failed(result))
         {
             UN_Error(false, "Couldn't create Vulkan compute pipeline, vkCreateComputePipelines returned {}", result);
             return VulkanConvert(result);
         }
 
+        device->SetDebugName(VK_OBJECT_TYPE_SHADER_MODULE, reinterpret_cast<UInt64>(m_ShaderModule), m_Name);
+        device->SetDebugName(VK_OBJECT_TYPE_PIPELINE, reinterpret_cast<UInt64>(m_Pipeline), m_Name);
         return ResultCode::Success;
     }
 
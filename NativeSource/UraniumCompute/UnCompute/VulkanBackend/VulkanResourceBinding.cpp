@@ -2,21 +2,24 @@
 #include <UnCompute/VulkanBackend/VulkanBuffer.h>
 #include <UnCompute/VulkanBackend/VulkanComputeDevice.h>
 #include <UnCompute/VulkanBackend/VulkanDescriptorAllocator.h>
-#include <UnCompute/VulkanBackend/VulkanResourceBinding.h>
 #include <UnCompute/VulkanBackend/VulkanDeviceMemory.h>
+#include <UnCompute/VulkanBackend/VulkanImage.h>
+#include <UnCompute/VulkanBackend/VulkanResourceBinding.h>
+#include <UnCompute/VulkanBackend/VulkanSampler.h>
 
 namespace UN
 {
-    inline VkDescriptorType GetDescriptorType(KernelResourceKind kind)
+    inline VkDescriptorType GetDescriptorType(const KernelResourceDesc& desc)
     {
-        switch (kind)
+        switch (desc.Kind)
         {
         case KernelResourceKind::Buffer:
-            return VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
+            // Read-only structured and byte address buffers are compiled to storage buffers in SPIR-V
+            return desc.IsTexelBuffer() ? VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
         case KernelResourceKind::ConstantBuffer:
             return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
         case KernelResourceKind::RWBuffer:
-            return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            return desc.IsTexelBuffer() ? VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
         case KernelResourceKind::SampledTexture:
             return VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
         case KernelResourceKind::RWTexture:
@@ -24,7 +27,7 @@ namespace UN
         case KernelResourceKind::Sampler:
             return VK_DESCRIPTOR_TYPE_SAMPLER;
         default:
-            UN_Error(false, "Unknown KernelResourceKind::<{}>", static_cast<Int32>(kind));
+            UN_Error(false, "Unknown KernelResourceKind::<{}>", static_cast<Int32>(desc.Kind));
             return VK_DESCRIPTOR_TYPE_MAX_ENUM;
         }
     }
@@ -36,18 +39,26 @@ namespace UN
 
     void VulkanResourceBinding::Reset()
     {
+        m_Images.clear();
         if (m_DescriptorSet == VK_NULL_HANDLE)
         {
             return;
         }
 
         m_DescriptorSet = VK_NULL_HANDLE;
-        auto vkDevice   = m_pDevice.As<VulkanComputeDevice>()->GetNativeDevice();
-        vkDestroyDescriptorSetLayout(vkDevice, m_SetLayout, nullptr);
+
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+        deviceTable.vkDestroyDescriptorSetLayout(vkDevice, m_SetLayout, nullptr);
     }
 
     ResultCode VulkanResourceBinding::InitInternal(const DescriptorType& desc)
     {
+        auto device       = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = device->GetNativeDevice();
+        auto& deviceTable = device->GetDeviceTable();
+
         std::vector<VkDescriptorSetLayoutBinding> bindings;
         for (UInt32 i = 0; i < desc.Layout.Length(); ++i)
         {
@@ -56,8 +67,25 @@ namespace UN
 
             binding.binding         = d.BindingIndex;
             binding.descriptorCount = 1;
-            binding.descriptorType  = GetDescriptorType(d.Kind);
+            binding.descriptorType  = GetDescriptorType(d);
             binding.stageFlags      = VK_SHADER_STAGE_COMPUTE_BIT;
+
+            if (d.IsTexelBuffer())
+            {
+                auto requiredFeature = d.Kind == KernelResourceKind::RWBuffer ? VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_BIT
+                                                                              : VK_FORMAT_FEATURE_UNIFORM_TEXEL_BUFFER_BIT;
+
+                VkFormatProperties formatProperties;
+                vkGetPhysicalDeviceFormatProperties(device->GetNativeAdapter(), VulkanConvert(d.Format), &formatProperties);
+                if ((formatProperties.bufferFeatures & requiredFeature) == 0)
+                {
+                    UN_Error(false,
+                             "Texel format <{}> of the variable at binding index {} is not supported by the device",
+                             static_cast<Int32>(d.Format),
+                             d.BindingIndex);
+                    return ResultCode::InvalidArguments;
+                }
+            }
         }
 
         VkDescriptorSetLayoutCreateInfo layoutCI{};
@@ -65,10 +93,7 @@ namespace UN
         layoutCI.bindingCount = static_cast<UInt32>(bindings.size());
         layoutCI.pBindings    = bindings.data();
 
-        auto device   = m_pDevice.As<VulkanComputeDevice>();
-        auto vkDevice = device->GetNativeDevice();
-
-        if (auto result = vkCreateDescriptorSetLayout(vkDevice, &layoutCI, VK_NULL_HANDLE, &m_SetLayout); Failed(result))
+        if (auto result = deviceTable.vkCreateDescriptorSetLayout(vkDevice, &layoutCI, nullptr, &m_SetLayout); Failed(result))
         {
             UN_Error(false, "Couldn't create Vulkan descriptor set layout, vkCreateDescriptorSetLayout returned {}", result);
             return VulkanConvert(result);
@@ -85,12 +110,16 @@ namespace UN
         pipelineLayoutCI.pSetLayouts    = &m_SetLayout;
         pipelineLayoutCI.setLayoutCount = 1;
 
-        if (auto result = vkCreatePipelineLayout(vkDevice, &pipelineLayoutCI, nullptr, &m_PipelineLayout); Failed(result))
+        auto result = deviceTable.vkCreatePipelineLayout(vkDevice, &pipelineLayoutCI, nullptr, &m_PipelineLayout);
+        if (Failed(result))
         {
             UN_Error(false, "Couldn't create Vulkan compute pipeline layout, vkCreatePipelineLayout returned {}", result);
             return VulkanConvert(result);
         }
 
+        device->SetDebugName(VK_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT, reinterpret_cast<UInt64>(m_SetLayout), m_Name);
+        device->SetDebugName(VK_OBJECT_TYPE_DESCRIPTOR_SET, reinterpret_cast<UInt64>(m_DescriptorSet), m_Name);
+        device->SetDebugName(VK_OBJECT_TYPE_PIPELINE_LAYOUT, reinterpret_cast<UInt64>(m_PipelineLayout), m_Name);
         return ResultCode::Success;
     }
 
@@ -106,7 +135,7 @@ namespace UN
         Reset();
     }
 
-    ResultCode VulkanResourceBinding::SetVariable(Int32 bindingIndex, IBuffer* pBuffer)
+    const KernelResourceDesc* VulkanResourceBinding::FindBinding(Int32 bindingIndex) const
     {
         auto* pBinding = std::find_if(m_Desc.Layout.begin(), m_Desc.Layout.end(), [bindingIndex](const KernelResourceDesc& desc) {
             return desc.BindingIndex == bindingIndex;
@@ -115,6 +144,17 @@ namespace UN
         if (pBinding == m_Desc.Layout.end())
         {
             UN_Error(false, "No variable at binding index {} found in RB \"{}\"", bindingIndex, GetDebugName());
+            return nullptr;
+        }
+
+        return pBinding;
+    }
+
+    ResultCode VulkanResourceBinding::SetVariable(Int32 bindingIndex, IBuffer* pBuffer)
+    {
+        auto* pBinding = FindBinding(bindingIndex);
+        if (pBinding == nullptr)
+        {
             return ResultCode::InvalidArguments;
         }
 
@@ -141,13 +181,110 @@ namespace UN
         VkWriteDescriptorSet writeDescriptorSet{};
         writeDescriptorSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
         writeDescriptorSet.dstSet          = m_DescriptorSet;
-        writeDescriptorSet.descriptorType  = GetDescriptorType(pBinding->Kind);
+        writeDescriptorSet.descriptorType  = GetDescriptorType(*pBinding);
+        writeDescriptorSet.dstBinding      = bindingIndex;
+        writeDescriptorSet.descriptorCount = 1;
+
+        VkBufferView bufferView = VK_NULL_HANDLE;
+        if (pBinding->IsTexelBuffer())
+        {
+            if (auto result = pVkBuffer->GetBufferView(pBinding->Format, &bufferView); Failed(result))
+            {
+                return result;
+            }
+
+            writeDescriptorSet.pTexelBufferView = &bufferView;
+        }
+        else
+        {
+            writeDescriptorSet.pBufferInfo = &bufferInfo;
+        }
+
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+        deviceTable.vkUpdateDescriptorSets(vkDevice, 1, &writeDescriptorSet, 0, nullptr);
+        return ResultCode::Success;
+    }
+
+    ResultCode VulkanResourceBinding::SetVariable(Int32 bindingIndex, IImage* pImage)
+    {
+        auto* pBinding = FindBinding(bindingIndex);
+        if (pBinding == nullptr)
+        {
+            return ResultCode::InvalidArguments;
+        }
+
+        if (pBinding->Kind != KernelResourceKind::SampledTexture && pBinding->Kind != KernelResourceKind::RWTexture)
+        {
+            UN_Error(false, "Variable at binding index {} from RB \"{}\" was not a texture", bindingIndex, GetDebugName());
+            return ResultCode::InvalidArguments;
+        }
+
+        auto* pVkImage = un_verify_cast<VulkanImage*>(pImage);
+
+        VkDescriptorImageInfo imageInfo{};
+        imageInfo.imageView   = pVkImage->GetNativeImageView();
+        imageInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+
+        VkWriteDescriptorSet writeDescriptorSet{};
+        writeDescriptorSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writeDescriptorSet.dstSet          = m_DescriptorSet;
+        writeDescriptorSet.descriptorType  = GetDescriptorType(*pBinding);
+        writeDescriptorSet.dstBinding      = bindingIndex;
+        writeDescriptorSet.pImageInfo      = &imageInfo;
+        writeDescriptorSet.descriptorCount = 1;
+
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+        deviceTable.vkUpdateDescriptorSets(vkDevice, 1, &writeDescriptorSet, 0, nullptr);
+
+        auto imageIter = std::find_if(m_Images.begin(), m_Images.end(), [bindingIndex](const auto& image) {
+            return image.first == bindingIndex;
+        });
+
+        if (imageIter == m_Images.end())
+        {
+            m_Images.emplace_back(bindingIndex, pVkImage);
+        }
+        else
+        {
+            imageIter->second = pVkImage;
+        }
+
+        return ResultCode::Success;
+    }
+
+    ResultCode VulkanResourceBinding::SetVariable(Int32 bindingIndex, ISampler* pSampler)
+    {
+        auto* pBinding = FindBinding(bindingIndex);
+        if (pBinding == nullptr)
+        {
+            return ResultCode::InvalidArguments;
+        }
+
+        if (pBinding->Kind != KernelResourceKind::Sampler)
+        {
+            UN_Error(false, "Variable at binding index {} from RB \"{}\" was not a sampler", bindingIndex, GetDebugName());
+            return ResultCode::InvalidArguments;
+        }
+
+        VkDescriptorImageInfo imageInfo{};
+        imageInfo.sampler = un_verify_cast<VulkanSampler*>(pSampler)->GetNativeSampler();
+
+        VkWriteDescriptorSet writeDescriptorSet{};
+        writeDescriptorSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writeDescriptorSet.dstSet          = m_DescriptorSet;
+        writeDescriptorSet.descriptorType  = VK_DESCRIPTOR_TYPE_SAMPLER;
         writeDescriptorSet.dstBinding      = bindingIndex;
-        writeDescriptorSet.pBufferInfo     = &bufferInfo;
+        writeDescriptorSet.pImageInfo      = &imageInfo;
         writeDescriptorSet.descriptorCount = 1;
 
-        auto* vkDevice = m_pDevice.As<VulkanComputeDevice>()->GetNativeDevice();
-        vkUpdateDescriptorSets(vkDevice, 1, &writeDescriptorSet, 0, nullptr);
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+        deviceTable.vkUpdateDescriptorSets(vkDevice, 1, &writeDescriptorSet, 0, nullptr);
         return ResultCode::Success;
     }
 } // namespace UN
@@ -1,9 +1,12 @@
 #pragma once
 #include <UnCompute/Backend/ResourceBindingBase.h>
+#include <UnCompute/Memory/Ptr.h>
 #include <UnCompute/VulkanBackend/VulkanInclude.h>
 
 namespace UN
 {
+    class VulkanImage;
+
     class VulkanResourceBinding final : public ResourceBindingBase
     {
         VkDescriptorSetLayout m_SetLayout = VK_NULL_HANDLE;
@@ -11,6 +14,11 @@ namespace UN
 
         VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
 
+        // Images bound to the variables, the command list must transition their layouts before a dispatch
+        std::vector<std::pair<Int32, Ptr<VulkanImage>>> m_Images;
+
+        [[nodiscard]] const KernelResourceDesc* FindBinding(Int32 bindingIndex) const;
+
     protected:
         ResultCode InitInternal(const DescriptorType& desc) override;
 
@@ -19,6 +27,8 @@ namespace UN
         ~VulkanResourceBinding() override;
 
         ResultCode SetVariable(Int32 bindingIndex, IBuffer* pBuffer) override;
+        ResultCode SetVariable(Int32 bindingIndex, IImage* pImage) override;
+        ResultCode SetVariable(Int32 bindingIndex, ISampler* pSampler) override;
 
         void Reset() override;
 
@@ -32,6 +42,11 @@ namespace UN
             return m_DescriptorSet;
         }
 
+        [[nodiscard]] inline const std::vector<std::pair<Int32, Ptr<VulkanImage>>>& GetBoundImages() const
+        {
+            return m_Images;
+        }
+
         static ResultCode Create(IComputeDevice* pDevice, IResourceBinding** ppResourceBinding);
     };
 } // namespace UN
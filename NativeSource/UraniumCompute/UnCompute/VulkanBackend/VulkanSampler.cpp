@@ -0,0 +1,94 @@
+#include <UnCompute/VulkanBackend/VulkanComputeDevice.h>
+#include <UnCompute/VulkanBackend/VulkanSampler.h>
+
+namespace UN
+{
+    inline VkFilter VulkanConvert(SamplerFilter filter)
+    {
+        switch (filter)
+        {
+        case SamplerFilter::Nearest:
+            return VK_FILTER_NEAREST;
+        case SamplerFilter::Linear:
+            return VK_FILTER_LINEAR;
+        default:
+            UN_Error(false, "Unknown SamplerFilter::<{}>", static_cast<Int32>(filter));
+            return VK_FILTER_MAX_ENUM;
+        }
+    }
+
+    inline VkSamplerAddressMode VulkanConvert(SamplerAddressMode addressMode)
+    {
+        switch (addressMode)
+        {
+        case SamplerAddressMode::Repeat:
+            return VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        case SamplerAddressMode::MirroredRepeat:
+            return VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT;
+        case SamplerAddressMode::ClampToEdge:
+            return VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        case SamplerAddressMode::ClampToBorder:
+            return VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER;
+        default:
+            UN_Error(false, "Unknown SamplerAddressMode::<{}>", static_cast<Int32>(addressMode));
+            return VK_SAMPLER_ADDRESS_MODE_MAX_ENUM;
+        }
+    }
+
+    VulkanSampler::VulkanSampler(IComputeDevice* pDevice)
+        : SamplerBase(pDevice)
+    {
+    }
+
+    ResultCode VulkanSampler::InitInternal(const DescriptorType& desc)
+    {
+        if (!desc.NormalizedCoordinates
+            && (desc.AddressMode == SamplerAddressMode::Repeat || desc.AddressMode == SamplerAddressMode::MirroredRepeat))
+        {
+            UN_Error(false, "Samplers with texel coordinates only support ClampToEdge and ClampToBorder address modes");
+            return ResultCode::InvalidArguments;
+        }
+
+        auto addressMode = VulkanConvert(desc.AddressMode);
+
+        VkSamplerCreateInfo samplerCI{};
+        samplerCI.sType                   = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+        samplerCI.magFilter               = VulkanConvert(desc.Filter);
+        samplerCI.minFilter               = VulkanConvert(desc.Filter);
+        samplerCI.mipmapMode              = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+        samplerCI.addressModeU            = addressMode;
+        samplerCI.addressModeV            = addressMode;
+        samplerCI.addressModeW            = addressMode;
+        samplerCI.borderColor             = VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK;
+        samplerCI.unnormalizedCoordinates = desc.NormalizedCoordinates ? VK_FALSE : VK_TRUE;
+        samplerCI.minLod                  = 0.0f;
+        samplerCI.maxLod                  = 0.0f;
+
+        auto* pDevice     = m_pDevice.As<VulkanComputeDevice>();
+        auto vkDevice     = pDevice->GetNativeDevice();
+        auto& deviceTable = pDevice->GetDeviceTable();
+        if (auto vkResult = deviceTable.vkCreateSampler(vkDevice, &samplerCI, nullptr, &m_NativeSampler); Failed(vkResult))
+        {
+            UN_Error(false, "Couldn't create Vulkan sampler, vkCreateSampler returned {}", vkResult);
+            return VulkanConvert(vkResult);
+        }
+
+        pDevice->SetDebugName(VK_OBJECT_TYPE_SAMPLER, reinterpret_cast<UInt64>(m_NativeSampler), m_Name);
+        return ResultCode::Success;
+    }
+
+    void VulkanSampler::Reset()
+    {
+        if (m_NativeSampler != VK_NULL_HANDLE)
+        {
+            auto* pDevice = m_pDevice.As<VulkanComputeDevice>();
+            pDevice->GetDeviceTable().vkDestroySampler(pDevice->GetNativeDevice(), m_NativeSampler, nullptr);
+            m_NativeSampler = VK_NULL_HANDLE;
+        }
+    }
+
+    VulkanSampler::~VulkanSampler()
+    {
+        Reset();
+    }
+} // namespace UN
@@ -0,0 +1,33 @@
+#pragma once
+#include <UnCompute/Backend/SamplerBase.h>
+#include <UnCompute/Memory/Memory.h>
+#include <UnCompute/VulkanBackend/VulkanInclude.h>
+
+namespace UN
+{
+    class VulkanSampler final : public SamplerBase
+    {
+        VkSampler m_NativeSampler = VK_NULL_HANDLE;
+
+    protected:
+        ResultCode InitInternal(const DescriptorType& desc) override;
+
+    public:
+        explicit VulkanSampler(IComputeDevice* pDevice);
+        ~VulkanSampler() override;
+
+        void Reset() override;
+
+        [[nodiscard]] inline VkSampler GetNativeSampler() const
+        {
+            return m_NativeSampler;
+        }
+
+        inline static ResultCode Create(IComputeDevice* pDevice, ISampler** ppSampler)
+        {
+            *ppSampler = AllocateObject<VulkanSampler>(pDevice);
+            (*ppSampler)->AddRef();
+            return ResultCode::Success;
+        }
+    };
+} // namespace UN